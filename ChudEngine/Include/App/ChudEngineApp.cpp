@@ -273,7 +273,7 @@ void ChudEngineApp::InitializeMeshComponents ()
             auto meshComp = actor->GetComponent<CE::CEMeshComponent> ();
             if (meshComp)
                 {
-                auto vertices = meshComp->GetVertices ();
+                const auto & vertices = meshComp->GetVertices ();
                 if (vertices.empty ())
                     {
                     CE_CORE_WARN ( "Mesh component for actor '{}' has no vertices", actor->GetName () );
@@ -1,6 +1,8 @@
 #include "ChudEngineApp.hpp"
 #include "Utils/FileSystem.hpp"
 #include "Utils/Logger.hpp"
+#include "Core/Jobs/CEJobSystem.hpp"
+#include "Core/Memory/CEFrameAllocator.hpp"
 
 
 int main ()
@@ -13,8 +15,12 @@ int main ()
 	CE::Logger::SetLogLevel ( CE::LogLevel::Trace );
 #else
 	CE::Logger::SetLogLevel ( CE::LogLevel::Info );
+	CE::Logger::SetAsyncMode ( true );
 #endif // _DEBUG
 
+	CE::CEJobSystem::Init ();
+	CE::CEFrameAllocator::Init ();
+
 	CE_CORE_DEBUG ( "ChudEngine Starting - Vulkan Renderer Test" );
 
 
@@ -26,11 +32,16 @@ int main ()
 		catch (const std::exception & e)
 			{
 			CE_CORE_ERROR ( "Exception: {}", e.what () );
+			CE::CEFrameAllocator::Shutdown ();
+			CE::CEJobSystem::Shutdown ();
+			CE::Logger::Shutdown ();
 			return 1;
 			}
 
 
 		CE_CORE_DEBUG ( "ChudEngine Shutdown..." );
+		CE::CEFrameAllocator::Shutdown ();
+		CE::CEJobSystem::Shutdown ();
 		CE::Logger::Shutdown ();
 		
 		return 0;
@@ -19,29 +19,16 @@ namespace CE
 		CE_DEBUG ( "CEWorldRenderer destroyed" );
 		}
 
-	std::vector<CEMeshComponent *> CEWorldRenderer::GatherMeshComponents ()
+	CEFrameVector<CEMeshComponent *> CEWorldRenderer::GatherMeshComponents () const
 		{
-		std::vector<CEMeshComponent *> meshComponents;
-
 		if (!m_World)
 			{
 			CE_DEBUG ( "No world set for mesh gathering" );
-			return meshComponents;
-			}
-
-			//      
-		auto components = m_World->GetComponentsOfType<CEMeshComponent> ();
-		CE_DEBUG ( "Found {} mesh components in world", components.size () );
-
-		for (auto * component : components)
-			{
-			if (component)
-				{
-				meshComponents.push_back ( component );
-				}
+			return {};
 			}
 
-		return meshComponents;
+			//  ,   CEMeshComponent;  ,   
+		return m_World->GetComponentsOfType<CEMeshComponent> ();
 		}
 
 	void CEWorldRenderer::Render ( VkCommandBuffer commandBuffer )
@@ -73,16 +60,37 @@ namespace CE
 			//       
 		staticMeshPipeline->Bind ( commandBuffer );
 
+			//  :        
+		if (m_World->IsEntityStorageEnabled ())
+			{
+			m_World->Query<const CEWorldTransformData, const CEMeshData> ().ForEach (
+				[ & ] ( const CEWorldTransformData & transform, const CEMeshData & mesh )
+				{
+				RenderMeshComponent ( mesh.Mesh, transform.Matrix, commandBuffer, staticMeshPipeline );
+				} );
+			}
+
 		for (auto * meshComponent : meshComponents)
 			{
-			if (meshComponent)
+			if (!meshComponent || meshComponent->IsDrawnFromEntity ())
+				{
+				continue;
+				}
+
+			auto * owner = meshComponent->GetOwner ();
+			auto * transform = owner ? owner->GetTransform () : nullptr;
+			if (!transform)
 				{
-				RenderMeshComponent ( meshComponent, commandBuffer, staticMeshPipeline );
+				CE_ERROR ( "No transform for mesh component '{}'", meshComponent->GetName () );
+				continue;
 				}
+
+			RenderMeshComponent ( meshComponent, transform->GetWorldTransform (), commandBuffer, staticMeshPipeline );
 			}
 		}
 
 	void CEWorldRenderer::RenderMeshComponent ( CEMeshComponent * meshComponent,
+												const Math::Matrix4 & modelMatrix,
 												VkCommandBuffer commandBuffer,
 												CEStaticMeshPipeline * pipeline )
 		{
@@ -92,20 +100,7 @@ namespace CE
 			return;
 			}
 
-			// GET TRANSFORM MATRICES
-		auto * owner = meshComponent->GetOwner ();
-		auto * transform = owner ? owner->GetTransform () : nullptr;
-
-		if (!transform)
-			{
-			CE_ERROR ( "No transform for mesh component '{}'", meshComponent->GetName () );
-			return;
-			}
-
-	
-
    //   // Calculate matrices
-		Math::Matrix4 modelMatrix = transform->GetWorldTransform ();
 		Math::Matrix4 viewMatrix = m_Renderer->GetViewMatrix ();
 		Math::Matrix4 projectionMatrix = m_Renderer->GetProjectionMatrix ();
 
@@ -123,13 +118,10 @@ namespace CE
 
 		
 		
-		if (transform)
-			{
-			CE_DEBUG ( "Raw Position: ({:.2f}, {:.2f}, {:.2f})",
-					   transform->GetPosition ().x,
-					   transform->GetPosition ().y,
-					   transform->GetPosition ().z );
-			}
+		CE_DEBUG ( "Raw Position: ({:.2f}, {:.2f}, {:.2f})",
+				   modelMatrix[ 12 ],
+				   modelMatrix[ 13 ],
+				   modelMatrix[ 14 ] );
 
 			//  
 		modelMatrix.DebugPrint ( "Model Matrix" );
@@ -147,7 +139,7 @@ namespace CE
 				   clipPos.x, clipPos.y, clipPos.z );
 
 		CE_DEBUG ( "=== VERTEX CLIP SPACE ANALYSIS ===" );
-		auto vertices = meshComponent->GetVertices ();
+		const auto & vertices = meshComponent->GetVertices ();
 		for (size_t i = 0; i < vertices.size (); ++i)
 			{
 			Math::Vector4 localPos ( vertices[ i ].Position, 1.0f );
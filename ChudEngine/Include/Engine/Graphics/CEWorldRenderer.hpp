@@ -21,8 +21,9 @@ namespace CE
             void Render ( VkCommandBuffer commandBuffer );
 
         private:
-            std::vector<CEMeshComponent *> GatherMeshComponents ();
+            CEFrameVector<CEMeshComponent *> GatherMeshComponents () const;
             void RenderMeshComponent ( CEMeshComponent * meshComponent,
+                                       const Math::Matrix4 & modelMatrix,
                                        VkCommandBuffer commandBuffer,
                                        CEStaticMeshPipeline * pipeline );
             bool EnsureMeshBuffersCreated ( CEMeshComponent * meshComponent );
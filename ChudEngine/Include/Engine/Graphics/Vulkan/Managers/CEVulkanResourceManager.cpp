@@ -18,7 +18,7 @@ namespace CE
         }
 
     std::shared_ptr<CEVulkanBuffer> CEVulkanResourceManager::CreateBuffer (
-        const std::string & name, VkDeviceSize size,
+        const FName & name, VkDeviceSize size,
         VkBufferUsageFlags usage, VkMemoryPropertyFlags properties )
         {
             // Check if buffer already exists
@@ -48,7 +48,7 @@ namespace CE
             return nullptr;
         }
 
-    std::shared_ptr<CEVulkanBuffer> CEVulkanResourceManager::GetBuffer ( const std::string & name )
+    std::shared_ptr<CEVulkanBuffer> CEVulkanResourceManager::GetBuffer ( const FName & name )
         {
         auto it = m_Buffers.find ( name );
         if (it != m_Buffers.end ())
@@ -60,7 +60,7 @@ namespace CE
         return nullptr;
         }
 
-    void CEVulkanResourceManager::DestroyBuffer ( const std::string & name )
+    void CEVulkanResourceManager::DestroyBuffer ( const FName & name )
         {
         auto it = m_Buffers.find ( name );
         if (it != m_Buffers.end ())
@@ -79,7 +79,7 @@ namespace CE
         }
 
     std::shared_ptr<CEVulkanImage> CEVulkanResourceManager::CreateImage (
-        const std::string & name, uint32_t width, uint32_t height,
+        const FName & name, uint32_t width, uint32_t height,
         VkFormat format, VkImageUsageFlags usage )
         {
             // Check if image already exists
@@ -111,7 +111,7 @@ namespace CE
             return nullptr;
         }
 
-    std::shared_ptr<CEVulkanImage> CEVulkanResourceManager::GetImage ( const std::string & name )
+    std::shared_ptr<CEVulkanImage> CEVulkanResourceManager::GetImage ( const FName & name )
         {
         auto it = m_Images.find ( name );
         if (it != m_Images.end ())
@@ -123,7 +123,7 @@ namespace CE
         return nullptr;
         }
 
-    void CEVulkanResourceManager::DestroyImage ( const std::string & name )
+    void CEVulkanResourceManager::DestroyImage ( const FName & name )
         {
         auto it = m_Images.find ( name );
         if (it != m_Images.end ())
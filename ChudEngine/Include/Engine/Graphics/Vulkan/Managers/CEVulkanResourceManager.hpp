@@ -4,6 +4,7 @@
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include "Core/Name/CEName.hpp"
 
 namespace CE
     {
@@ -18,16 +19,16 @@ namespace CE
             ~CEVulkanResourceManager ();
 
             // Buffer management
-            std::shared_ptr<CEVulkanBuffer> CreateBuffer ( const std::string & name, VkDeviceSize size,
+            std::shared_ptr<CEVulkanBuffer> CreateBuffer ( const FName & name, VkDeviceSize size,
                                                            VkBufferUsageFlags usage, VkMemoryPropertyFlags properties );
-            std::shared_ptr<CEVulkanBuffer> GetBuffer ( const std::string & name );
-            void DestroyBuffer ( const std::string & name );
+            std::shared_ptr<CEVulkanBuffer> GetBuffer ( const FName & name );
+            void DestroyBuffer ( const FName & name );
 
             // Image management
-            std::shared_ptr<CEVulkanImage> CreateImage ( const std::string & name, uint32_t width, uint32_t height,
+            std::shared_ptr<CEVulkanImage> CreateImage ( const FName & name, uint32_t width, uint32_t height,
                                                          VkFormat format, VkImageUsageFlags usage );
-            std::shared_ptr<CEVulkanImage> GetImage ( const std::string & name );
-            void DestroyImage ( const std::string & name );
+            std::shared_ptr<CEVulkanImage> GetImage ( const FName & name );
+            void DestroyImage ( const FName & name );
 
             // Cleanup
             void Cleanup ();
@@ -35,8 +36,8 @@ namespace CE
 
         private:
             CEVulkanContext * m_Context = nullptr;
-            std::unordered_map<std::string, std::shared_ptr<CEVulkanBuffer>> m_Buffers;
-            std::unordered_map<std::string, std::shared_ptr<CEVulkanImage>> m_Images;
+            std::unordered_map<FName, std::shared_ptr<CEVulkanBuffer>> m_Buffers;
+            std::unordered_map<FName, std::shared_ptr<CEVulkanImage>> m_Images;
 
             size_t m_TotalBufferMemory = 0;
             size_t m_TotalImageMemory = 0;
@@ -21,7 +21,8 @@ namespace CE
         const std::string & filename, VkShaderStageFlagBits stage )
         {
             // Check if shader is already loaded
-        auto it = m_ShaderModules.find ( filename );
+        FName key ( filename );
+        auto it = m_ShaderModules.find ( key );
         if (it != m_ShaderModules.end ())
             {
             return it->second;
@@ -38,7 +39,7 @@ namespace CE
             shader->path = filename;
             shader->stage = stage;
 
-            m_ShaderModules[ filename ] = shader;
+            m_ShaderModules[ key ] = shader;
             CE_CORE_DEBUG ( "Loaded shader: {} (stage: {})", filename, GetShaderStageName ( stage ) );
 
             return shader;
@@ -67,7 +68,7 @@ namespace CE
             {
             try
                 {
-                std::vector<uint32_t> newCode = ReadSPIRVFile ( filename );
+                std::vector<uint32_t> newCode = ReadSPIRVFile ( filename.ToString () );
                 VkShaderModule newModule = CreateShaderModule ( newCode );
 
                 // Destroy old module
@@ -5,6 +5,7 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include "Core/Name/CEName.hpp"
 
 namespace CE
     {
@@ -41,6 +42,6 @@ namespace CE
             VkShaderModule CreateShaderModule ( const std::vector<uint32_t> & code );
 
             CEVulkanContext * m_Context = nullptr;
-            std::unordered_map<std::string, std::shared_ptr<ShaderModule>> m_ShaderModules;
+            std::unordered_map<FName, std::shared_ptr<ShaderModule>> m_ShaderModules;
         };
     }
\ No newline at end of file
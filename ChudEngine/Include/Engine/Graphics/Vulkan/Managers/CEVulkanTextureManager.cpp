@@ -372,7 +372,8 @@ namespace CE
 
     std::shared_ptr<CEVulkanTexture> CEVulkanTextureManager::LoadTexture ( const std::string & filename )
         {
-        auto it = m_Textures.find ( filename );
+        FName key ( filename );
+        auto it = m_Textures.find ( key );
         if (it != m_Textures.end ())
             {
             return it->second;
@@ -381,7 +382,7 @@ namespace CE
         auto texture = std::make_shared<CEVulkanTexture> ();
         if (texture->CreateFromFile ( m_Context, filename ))
             {
-            m_Textures[ filename ] = texture;
+            m_Textures[ key ] = texture;
             return texture;
             }
 
@@ -389,7 +390,7 @@ namespace CE
         return GetDefaultTexture ();
         }
 
-    std::shared_ptr<CEVulkanTexture> CEVulkanTextureManager::CreateTexture ( const std::string & name, uint32_t width, uint32_t height,
+    std::shared_ptr<CEVulkanTexture> CEVulkanTextureManager::CreateTexture ( const FName & name, uint32_t width, uint32_t height,
                                                                              VkFormat format, const void * data )
         {
         auto it = m_Textures.find ( name );
@@ -2,6 +2,7 @@
 #pragma once
 #include <unordered_map>
 #include <string>
+#include "Core/Name/CEName.hpp"
 #include <memory>
 #include <vulkan/vulkan.h>
 
@@ -62,12 +63,12 @@ namespace CE
             void Shutdown ();
 
             std::shared_ptr<CEVulkanTexture> LoadTexture ( const std::string & filename );
-            std::shared_ptr<CEVulkanTexture> CreateTexture ( const std::string & name, uint32_t width, uint32_t height,
+            std::shared_ptr<CEVulkanTexture> CreateTexture ( const FName & name, uint32_t width, uint32_t height,
                                                              VkFormat format, const void * data = nullptr );
-            std::shared_ptr<CEVulkanTexture> CreateRenderTarget ( const std::string & name, uint32_t width, uint32_t height,
+            std::shared_ptr<CEVulkanTexture> CreateRenderTarget ( const FName & name, uint32_t width, uint32_t height,
                                                                   VkFormat format, VkImageUsageFlags usage );
-            std::shared_ptr<CEVulkanTexture> GetTexture ( const std::string & name );
-            void DestroyTexture ( const std::string & name );
+            std::shared_ptr<CEVulkanTexture> GetTexture ( const FName & name );
+            void DestroyTexture ( const FName & name );
 
             std::shared_ptr<CEVulkanTexture> GetDefaultTexture ();
             std::shared_ptr<CEVulkanTexture> GetNormalMapTexture ();
@@ -78,7 +79,7 @@ namespace CE
             bool CreateDefaultTextures ();
 
             CEVulkanContext * m_Context = nullptr;
-            std::unordered_map<std::string, std::shared_ptr<CEVulkanTexture>> m_Textures;
+            std::unordered_map<FName, std::shared_ptr<CEVulkanTexture>> m_Textures;
 
             std::shared_ptr<CEVulkanTexture> m_DefaultTexture;
             std::shared_ptr<CEVulkanTexture> m_NormalMapTexture;
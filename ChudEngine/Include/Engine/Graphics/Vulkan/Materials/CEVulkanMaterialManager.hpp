@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include "Core/Name/CEName.hpp"
 
 namespace CE
     {
@@ -22,10 +23,10 @@ namespace CE
                               CEVulkanTextureManager * textureManager );
             void Shutdown ();
 
-            std::shared_ptr<CEVulkanMaterial> CreateMaterial ( const std::string & name );
+            std::shared_ptr<CEVulkanMaterial> CreateMaterial ( const FName & name );
             std::shared_ptr<CEVulkanMaterial> LoadMaterial ( const std::string & filepath );
-            std::shared_ptr<CEVulkanMaterial> GetMaterial ( const std::string & name );
-            void DestroyMaterial ( const std::string & name );
+            std::shared_ptr<CEVulkanMaterial> GetMaterial ( const FName & name );
+            void DestroyMaterial ( const FName & name );
 
             void ReloadAllMaterials ();
             void UpdateMaterials ( uint32_t currentFrame );
@@ -40,7 +41,7 @@ namespace CE
             CEVulkanPipelineManager * m_PipelineManager = nullptr;
             CEVulkanTextureManager * m_TextureManager = nullptr;
 
-            std::unordered_map<std::string, std::shared_ptr<CEVulkanMaterial>> m_Materials;
+            std::unordered_map<FName, std::shared_ptr<CEVulkanMaterial>> m_Materials;
             std::shared_ptr<CEVulkanMaterial> m_DefaultMaterial;
             std::shared_ptr<CEVulkanMaterial> m_ErrorMaterial;
         };
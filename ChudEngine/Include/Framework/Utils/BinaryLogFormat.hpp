@@ -0,0 +1,113 @@
+// Framework/Utils/BinaryLogFormat.hpp
+// On-disk layout of the binary log sink. Shared by Logger and LogDecoderTool, so keep it free of engine dependencies.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace CE::BinaryLog
+    {
+        // File = FILE_MAGIC followed by records. All integers are little-endian, written as-is.
+    constexpr char FILE_MAGIC[ 8 ] = { 'C', 'E', 'B', 'L', 'O', 'G', '0', '1' };
+
+    enum class RecordType : uint8_t
+        {
+        Format = 1,   // u32 id, u8 level, u16 category length, category, u32 format length, format
+        Message = 2   // u32 format id, i64 timestamp (ns since Unix epoch), u8 arg count, args
+        };
+
+    // Each argument is a type tag followed by its raw bytes
+    enum class ArgType : uint8_t
+        {
+        Int64 = 1,
+        UInt64,
+        Double,
+        Bool,
+        Char,
+        String,   // u32 length, bytes
+        Pointer   // u64
+        };
+
+    template<typename T>
+    inline void AppendRaw ( std::string & Out, const T & Value )
+        {
+        static_assert( std::is_trivially_copyable_v<T> );
+        Out.append ( reinterpret_cast< const char * >( &Value ), sizeof ( T ) );
+        }
+
+    inline void AppendString ( std::string & Out, std::string_view Value )
+        {
+        AppendRaw ( Out, static_cast< uint32_t >( Value.size () ) );
+        Out.append ( Value.data (), Value.size () );
+        }
+
+    inline void AppendFormatRecord ( std::string & Out, uint32_t Id, uint8_t Level, std::string_view Category, std::string_view Format )
+        {
+        AppendRaw ( Out, RecordType::Format );
+        AppendRaw ( Out, Id );
+        AppendRaw ( Out, Level );
+        AppendRaw ( Out, static_cast< uint16_t >( Category.size () ) );
+        Out.append ( Category.data (), Category.size () );
+        AppendString ( Out, Format );
+        }
+
+    inline void BeginMessageRecord ( std::string & Out, uint32_t FormatId, int64_t TimestampNs, uint8_t ArgCount )
+        {
+        AppendRaw ( Out, RecordType::Message );
+        AppendRaw ( Out, FormatId );
+        AppendRaw ( Out, TimestampNs );
+        AppendRaw ( Out, ArgCount );
+        }
+
+        // Numbers and strings are stored raw; anything else std::format understands is stored pre-formatted
+    template<typename T>
+    inline void AppendArg ( std::string & Out, const T & Value )
+        {
+        using ValueType = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<ValueType, bool>)
+            {
+            AppendRaw ( Out, ArgType::Bool );
+            AppendRaw ( Out, static_cast< uint8_t >( Value ? 1 : 0 ) );
+            }
+        else if constexpr (std::is_same_v<ValueType, char>)
+            {
+            AppendRaw ( Out, ArgType::Char );
+            AppendRaw ( Out, Value );
+            }
+        else if constexpr (std::is_integral_v<ValueType> && std::is_signed_v<ValueType>)
+            {
+            AppendRaw ( Out, ArgType::Int64 );
+            AppendRaw ( Out, static_cast< int64_t >( Value ) );
+            }
+        else if constexpr (std::is_integral_v<ValueType>)
+            {
+            AppendRaw ( Out, ArgType::UInt64 );
+            AppendRaw ( Out, static_cast< uint64_t >( Value ) );
+            }
+        else if constexpr (std::is_floating_point_v<ValueType>)
+            {
+            AppendRaw ( Out, ArgType::Double );
+            AppendRaw ( Out, static_cast< double >( Value ) );
+            }
+        else if constexpr (std::is_convertible_v<const T &, std::string_view>)
+            {
+            AppendRaw ( Out, ArgType::String );
+            AppendString ( Out, std::string_view ( Value ) );
+            }
+        else if constexpr (std::is_pointer_v<ValueType>)
+            {
+            AppendRaw ( Out, ArgType::Pointer );
+            AppendRaw ( Out, static_cast< uint64_t >( reinterpret_cast< uintptr_t >( Value ) ) );
+            }
+        else
+            {
+            AppendRaw ( Out, ArgType::String );
+            AppendString ( Out, std::format ( "{}", Value ) );
+            }
+        }
+    }
@@ -1,5 +1,9 @@
 #include "Logger.hpp"
 #include "FileSystem.hpp"
+#include <condition_variable>
+#include <memory>
+#include <thread>
+#include <vector>
 
 //   
 namespace CE
@@ -8,11 +12,140 @@ namespace CE
     std::mutex Logger::logMutex;
     bool Logger::writeToFile = false;
     std::string Logger::logFileName = "app.log";
-    LogLevel Logger::currentLogLevel = LogLevel::Info;
+    std::atomic<LogLevel> Logger::currentLogLevel { LogLevel::Info };
+    std::ofstream Logger::binaryLogFile;
+    std::atomic<bool> Logger::binarySinkEnabled { false };
 
-    bool Logger::ShouldLog ( LogLevel level )
+    namespace
         {
-        return static_cast< int >( level ) >= static_cast< int >( currentLogLevel );
+        void GetLevelStyle ( LogLevel level, const char *& levelStr, const char *& color )
+            {
+            switch (level)
+                {
+                    case LogLevel::Trace:    levelStr = "TRACE"; color = "\033[37m"; break;    // White
+                    case LogLevel::Debug:    levelStr = "DEBUG"; color = "\033[36m"; break;    // Cyan (   Debug)
+                    case LogLevel::Info:     levelStr = "INFO";  color = "\033[32m"; break;    // Green
+                    case LogLevel::Warn:     levelStr = "WARN";  color = "\033[33m"; break;    // Yellow
+                    case LogLevel::Error:    levelStr = "ERROR"; color = "\033[31m"; break;    // Red
+                    case LogLevel::Critical: levelStr = "CRITICAL"; color = "\033[41m"; break; // Red background
+                    default:                 levelStr = ""; color = ""; break;
+                }
+            }
+
+        struct LogRecord
+            {
+            LogLevel level = LogLevel::Info;
+            std::string text;
+            bool binary = false; // text -    
+            };
+
+            //      (ID =  + 1)
+        struct BinaryFormatEntry
+            {
+            LogLevel level;
+            std::string category;
+            std::string format;
+            };
+
+        std::mutex formatMutex;
+        std::vector<BinaryFormatEntry> binaryFormats;
+
+            //     ( ):      ,
+            //     CAS,   -  
+        class LogRingBuffer
+            {
+            public:
+                explicit LogRingBuffer ( size_t capacity )
+                    : cells ( new Cell[ capacity ] ), mask ( capacity - 1 )
+                    {
+                    for (size_t i = 0; i < capacity; ++i)
+                        {
+                        cells[ i ].sequence.store ( i, std::memory_order_relaxed );
+                        }
+                    }
+
+                bool TryPush ( LogRecord & record )
+                    {
+                    uint64_t position = enqueuePos.load ( std::memory_order_relaxed );
+                    while (true)
+                        {
+                        Cell & cell = cells[ position & mask ];
+                        uint64_t sequence = cell.sequence.load ( std::memory_order_acquire );
+                        int64_t diff = static_cast< int64_t >( sequence ) - static_cast< int64_t >( position );
+                        if (diff == 0)
+                            {
+                            if (enqueuePos.compare_exchange_weak ( position, position + 1, std::memory_order_relaxed ))
+                                {
+                                cell.record = std::move ( record );
+                                cell.sequence.store ( position + 1, std::memory_order_release );
+                                return true;
+                                }
+                            }
+                        else if (diff < 0)
+                            {
+                            return false; // 
+                            }
+                        else
+                            {
+                            position = enqueuePos.load ( std::memory_order_relaxed );
+                            }
+                        }
+                    }
+
+                bool TryPop ( LogRecord & outRecord )
+                    {
+                    uint64_t position = dequeuePos.load ( std::memory_order_relaxed );
+                    Cell & cell = cells[ position & mask ];
+                    uint64_t sequence = cell.sequence.load ( std::memory_order_acquire );
+                    if (sequence != position + 1) return false;
+
+                    outRecord = std::move ( cell.record );
+                    cell.record.text.clear ();
+                    cell.sequence.store ( position + mask + 1, std::memory_order_release );
+                    dequeuePos.store ( position + 1, std::memory_order_release );
+                    return true;
+                    }
+
+                uint64_t GetEnqueuePosition () const { return enqueuePos.load ( std::memory_order_acquire ); }
+                uint64_t GetDequeuePosition () const { return dequeuePos.load ( std::memory_order_acquire ); }
+
+            private:
+                struct alignas( 64 ) Cell
+                    {
+                    std::atomic<uint64_t> sequence { 0 };
+                    LogRecord record;
+                    };
+
+                std::unique_ptr<Cell[]> cells;
+                const uint64_t mask;
+                alignas( 64 ) std::atomic<uint64_t> enqueuePos { 0 };
+                alignas( 64 ) std::atomic<uint64_t> dequeuePos { 0 };
+            };
+
+            //   
+        std::unique_ptr<LogRingBuffer> asyncBuffer;
+        std::thread writerThread;
+        std::atomic<bool> asyncMode { false };
+        std::atomic<bool> writerRunning { false };
+        LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Drop;
+        std::atomic<uint64_t> flushedPosition { 0 };
+        std::atomic<uint64_t> droppedMessages { 0 };
+        std::atomic<uint64_t> droppedSinceReport { 0 };
+        std::atomic<bool> wakeRequested { false };
+        std::mutex wakeMutex;
+        std::condition_variable wakeCondition;
+        std::condition_variable flushedCondition;
+
+        constexpr auto WRITER_IDLE_WAIT = std::chrono::milliseconds ( 10 );
+
+        void WakeWriter ()
+            {
+                {
+                std::lock_guard<std::mutex> lock ( wakeMutex );
+                wakeRequested.store ( true, std::memory_order_relaxed );
+                }
+            wakeCondition.notify_one ();
+            }
         }
 
     std::string Logger::GetCurrentTime ()
@@ -30,7 +163,9 @@ namespace CE
         localtime_s ( &tm, &time_t );
         ss << std::put_time ( &tm, "%Y-%m-%d %H:%M:%S" );
 #else
-        ss << std::put_time ( std::localtime ( &time_t ), "%Y-%m-%d %H:%M:%S" );
+        std::tm tm;
+        localtime_r ( &time_t, &tm ); //   logMutex, std::localtime  
+        ss << std::put_time ( &tm, "%Y-%m-%d %H:%M:%S" );
 #endif
 
         ss << "." << std::setfill ( '0' ) << std::setw ( 3 ) << ms.count ();
@@ -59,7 +194,7 @@ namespace CE
             {
             std::lock_guard<std::mutex> lock ( logMutex );
 
-            currentLogLevel = level;
+            currentLogLevel.store ( level, std::memory_order_relaxed );
 
             if (logFile.is_open ())
                 {
@@ -99,18 +234,20 @@ namespace CE
 
     void Logger::SetLogLevel ( LogLevel level )
         {
-        std::lock_guard<std::mutex> lock ( logMutex );
-        currentLogLevel = level;
+        currentLogLevel.store ( level, std::memory_order_relaxed );
         }
 
     LogLevel Logger::GetLogLevel ()
         {
-        std::lock_guard<std::mutex> lock ( logMutex );
-        return currentLogLevel;
+        return currentLogLevel.load ( std::memory_order_relaxed );
         }
 
     void Logger::Shutdown ()
         {
+        //    ,    
+        SetAsyncMode ( false );
+        SetBinarySink ( false );
+
         try
             {
             std::lock_guard<std::mutex> lock ( logMutex );
@@ -134,23 +271,25 @@ namespace CE
             if (!ShouldLog ( level ))
                 return;
 
-            std::lock_guard<std::mutex> lock ( logMutex );
-
             const char * levelStr = "";
             const char * color = "";
+            GetLevelStyle ( level, levelStr, color );
 
-            switch (level)
+            std::string timestamp = GetCurrentTime ();
+            std::string formattedMessage = "[" + timestamp + "] [" + levelStr + "] " + message;
+
+            //  :     ,    
+            if (asyncMode.load ( std::memory_order_acquire ))
                 {
-                    case LogLevel::Trace:    levelStr = "TRACE"; color = "\033[37m"; break;    // White
-                    case LogLevel::Debug:    levelStr = "DEBUG"; color = "\033[36m"; break;    // Cyan (   Debug)
-                    case LogLevel::Info:     levelStr = "INFO";  color = "\033[32m"; break;    // Green
-                    case LogLevel::Warn:     levelStr = "WARN";  color = "\033[33m"; break;    // Yellow
-                    case LogLevel::Error:    levelStr = "ERROR"; color = "\033[31m"; break;    // Red
-                    case LogLevel::Critical: levelStr = "CRITICAL"; color = "\033[41m"; break; // Red background
+                PushAsync ( level, std::move ( formattedMessage ) );
+                if (level == LogLevel::Critical)
+                    {
+                    Flush ();
+                    }
+                return;
                 }
 
-            std::string timestamp = GetCurrentTime ();
-            std::string formattedMessage = "[" + timestamp + "] [" + levelStr + "] " + message;
+            std::lock_guard<std::mutex> lock ( logMutex );
 
             //     
             std::cout << color << formattedMessage << "\033[0m" << std::endl;
@@ -163,4 +302,263 @@ namespace CE
                 std::cerr << "Logger Log error: " << e.what () << std::endl;
                 }
         }
+
+    void Logger::SetAsyncMode ( bool enable, LogOverflowPolicy policy, size_t queueCapacity )
+        {
+        if (enable == asyncMode.load ( std::memory_order_acquire )) return;
+
+        if (enable)
+            {
+            size_t capacity = 2;
+            while (capacity < queueCapacity)
+                {
+                capacity <<= 1;
+                }
+
+            asyncBuffer = std::make_unique<LogRingBuffer> ( capacity );
+            overflowPolicy = policy;
+            flushedPosition.store ( 0, std::memory_order_relaxed );
+            writerRunning.store ( true, std::memory_order_release );
+            writerThread = std::thread ( &Logger::WriterLoop );
+            asyncMode.store ( true, std::memory_order_release );
+            }
+        else
+            {
+            asyncMode.store ( false, std::memory_order_release );
+            writerRunning.store ( false, std::memory_order_release );
+            WakeWriter ();
+            if (writerThread.joinable ())
+                {
+                writerThread.join ();
+                }
+            asyncBuffer.reset ();
+            }
+        }
+
+    bool Logger::IsAsyncMode ()
+        {
+        return asyncMode.load ( std::memory_order_acquire );
+        }
+
+    uint64_t Logger::GetDroppedMessageCount ()
+        {
+        return droppedMessages.load ( std::memory_order_relaxed );
+        }
+
+    void Logger::PushAsync ( LogLevel level, std::string && formattedMessage, bool binary, bool mustDeliver )
+        {
+        LogRecord record { level, std::move ( formattedMessage ), binary };
+        while (!asyncBuffer->TryPush ( record ))
+            {
+            if (overflowPolicy == LogOverflowPolicy::Drop && level != LogLevel::Critical && !mustDeliver)
+                {
+                droppedMessages.fetch_add ( 1, std::memory_order_relaxed );
+                droppedSinceReport.fetch_add ( 1, std::memory_order_relaxed );
+                return;
+                }
+
+                // Block (   Critical): ,     
+            WakeWriter ();
+            std::this_thread::yield ();
+            }
+        }
+
+    void Logger::Flush ()
+        {
+        if (!asyncMode.load ( std::memory_order_acquire ))
+            {
+            std::lock_guard<std::mutex> lock ( logMutex );
+            std::cout.flush ();
+            if (logFile.is_open ())
+                {
+                logFile.flush ();
+                }
+            if (binaryLogFile.is_open ())
+                {
+                binaryLogFile.flush ();
+                }
+            return;
+            }
+
+        // ,    ,       
+        uint64_t target = asyncBuffer->GetEnqueuePosition ();
+        std::unique_lock<std::mutex> lock ( wakeMutex );
+        wakeRequested.store ( true, std::memory_order_relaxed );
+        wakeCondition.notify_one ();
+        flushedCondition.wait ( lock, [ target ] ()
+                                {
+                                return flushedPosition.load ( std::memory_order_acquire ) >= target
+                                    || !writerRunning.load ( std::memory_order_acquire );
+                                } );
+        }
+
+    void Logger::WriterLoop ()
+        {
+        LogRecord record;
+        while (true)
+            {
+            bool bWroteAny = false;
+            {
+            std::lock_guard<std::mutex> lock ( logMutex );
+            while (asyncBuffer->TryPop ( record ))
+                {
+                bWroteAny = true;
+                if (record.binary)
+                    {
+                    if (binaryLogFile.is_open ())
+                        {
+                        binaryLogFile.write ( record.text.data (), static_cast< std::streamsize >( record.text.size () ) );
+                        }
+                    continue;
+                    }
+
+                const char * levelStr = "";
+                const char * color = "";
+                GetLevelStyle ( record.level, levelStr, color );
+
+                std::cout << color << record.text << "\033[0m\n";
+                if (writeToFile && logFile.is_open ())
+                    {
+                    logFile << record.text << '\n';
+                    }
+                }
+
+            uint64_t dropped = droppedSinceReport.exchange ( 0, std::memory_order_relaxed );
+            if (dropped > 0)
+                {
+                std::string notice = "[" + GetCurrentTime () + "] [WARN] [CORE] Logger: dropped " + std::to_string ( dropped )
+                    + " messages, async queue was full";
+                std::cout << "\033[33m" << notice << "\033[0m\n";
+                if (writeToFile && logFile.is_open ())
+                    {
+                    logFile << notice << '\n';
+                    }
+                bWroteAny = true;
+                }
+
+                //  flush    flush   
+            if (bWroteAny)
+                {
+                std::cout.flush ();
+                if (writeToFile && logFile.is_open ())
+                    {
+                    logFile.flush ();
+                    }
+                if (binaryLogFile.is_open ())
+                    {
+                    binaryLogFile.flush ();
+                    }
+                }
+            }
+
+            bool bStopping = !writerRunning.load ( std::memory_order_acquire );
+            {
+            std::unique_lock<std::mutex> lock ( wakeMutex );
+            flushedPosition.store ( asyncBuffer->GetDequeuePosition (), std::memory_order_release );
+            flushedCondition.notify_all ();
+
+            if (bStopping && asyncBuffer->GetDequeuePosition () == asyncBuffer->GetEnqueuePosition ())
+                {
+                break;
+                }
+
+            wakeCondition.wait_for ( lock, WRITER_IDLE_WAIT, [] ()
+                                     {
+                                     return wakeRequested.load ( std::memory_order_relaxed )
+                                         || !writerRunning.load ( std::memory_order_relaxed );
+                                     } );
+            wakeRequested.store ( false, std::memory_order_relaxed );
+            }
+            }
+        }
+
+    void Logger::SetBinarySink ( bool enable, const std::string & fileName )
+        {
+        if (!enable)
+            {
+            if (!binarySinkEnabled.exchange ( false, std::memory_order_acq_rel )) return;
+
+            //  ,     ,      
+            Flush ();
+            std::lock_guard<std::mutex> lock ( logMutex );
+            binaryLogFile.close ();
+            return;
+            }
+
+        std::lock_guard<std::mutex> formatLock ( formatMutex );
+        std::lock_guard<std::mutex> lock ( logMutex );
+
+        if (binaryLogFile.is_open ())
+            {
+            binaryLogFile.close ();
+            }
+
+        std::string logsDir = FileSystem::GetLogsDirectory ();
+        FileSystem::CreateDirectories ( logsDir );
+        std::string fullPath = FileSystem::Combine ( logsDir, fileName );
+
+        binaryLogFile.open ( fullPath, std::ios::binary | std::ios::trunc );
+        if (!binaryLogFile.is_open ())
+            {
+            std::cerr << "ERROR: Cannot open binary log file: " << fullPath << std::endl;
+            binarySinkEnabled.store ( false, std::memory_order_release );
+            return;
+            }
+
+        WriteBinaryHeader ();
+        binarySinkEnabled.store ( true, std::memory_order_release );
+        }
+
+    void Logger::WriteBinaryHeader ()
+        {
+            //          
+        binaryLogFile.write ( BinaryLog::FILE_MAGIC, sizeof ( BinaryLog::FILE_MAGIC ) );
+
+        std::string record;
+        for (size_t i = 0; i < binaryFormats.size (); ++i)
+            {
+            const BinaryFormatEntry & entry = binaryFormats[ i ];
+            BinaryLog::AppendFormatRecord ( record, static_cast< uint32_t >( i + 1 ), static_cast< uint8_t >( entry.level ),
+                                            entry.category, entry.format );
+            }
+        binaryLogFile.write ( record.data (), static_cast< std::streamsize >( record.size () ) );
+        }
+
+    uint32_t Logger::RegisterFormat ( LogFormatSite & site, LogLevel level, const char * category, std::string_view format )
+        {
+        std::lock_guard<std::mutex> lock ( formatMutex );
+
+        uint32_t formatId = site.id.load ( std::memory_order_acquire );
+        if (formatId != 0) return formatId;
+
+        binaryFormats.push_back ( { level, category, std::string ( format ) } );
+        formatId = static_cast< uint32_t >( binaryFormats.size () );
+
+        //      ,   ,      
+        std::string record;
+        BinaryLog::AppendFormatRecord ( record, formatId, static_cast< uint8_t >( level ), category, format );
+        WriteBinaryRecord ( level, std::move ( record ), true );
+
+        site.id.store ( formatId, std::memory_order_release );
+        return formatId;
+        }
+
+    void Logger::WriteBinaryRecord ( LogLevel level, std::string && record, bool mustDeliver )
+        {
+        if (asyncMode.load ( std::memory_order_acquire ))
+            {
+            PushAsync ( level, std::move ( record ), true, mustDeliver );
+            return;
+            }
+
+        std::lock_guard<std::mutex> lock ( logMutex );
+        if (binaryLogFile.is_open ())
+            {
+            binaryLogFile.write ( record.data (), static_cast< std::streamsize >( record.size () ) );
+            if (level == LogLevel::Critical)
+                {
+                binaryLogFile.flush ();
+                }
+            }
+        }
     }
\ No newline at end of file
@@ -5,8 +5,12 @@
 #include <format>
 #include <fstream>
 #include <mutex>
+#include <atomic>
+#include <cstdint>
 #include <chrono>
 #include <iomanip>
+#include <string_view>
+#include "BinaryLogFormat.hpp"
 
 namespace CE
     {
@@ -20,6 +24,19 @@ namespace CE
         Critical
         };
 
+    //    ,   
+    enum class LogOverflowPolicy
+        {
+        Drop,   //   (Critical   )
+        Block   // ,     
+        };
+
+    //   -: ID     ,    
+    struct LogFormatSite
+        {
+        std::atomic<uint32_t> id { 0 };
+        };
+
     class Logger
         {
         private:
@@ -27,11 +44,17 @@ namespace CE
             static std::mutex logMutex;
             static bool writeToFile;
             static std::string logFileName;
-            static LogLevel currentLogLevel;
+            static std::atomic<LogLevel> currentLogLevel;
+            static std::ofstream binaryLogFile;
+            static std::atomic<bool> binarySinkEnabled;
 
             static std::string GetCurrentTime ();
             static void WriteToFile ( const std::string & message );
-            static bool ShouldLog ( LogLevel level );
+            static void PushAsync ( LogLevel level, std::string && formattedMessage, bool binary = false, bool mustDeliver = false );
+            static uint32_t RegisterFormat ( LogFormatSite & site, LogLevel level, const char * category, std::string_view format );
+            static void WriteBinaryRecord ( LogLevel level, std::string && record, bool mustDeliver );
+            static void WriteBinaryHeader ();
+            static void WriterLoop ();
 
         public:
             static void Init ( const std::string & fileName = "app.log",
@@ -40,8 +63,51 @@ namespace CE
             static void Shutdown ();
             static void SetLogLevel ( LogLevel level );
             static LogLevel GetLogLevel ();
+
+            //       
+            static inline bool ShouldLog ( LogLevel level )
+                {
+                return static_cast< int >( level ) >= static_cast< int >( currentLogLevel.load ( std::memory_order_relaxed ) );
+                }
             static void Log ( LogLevel level, const std::string & message );
 
+            //  :          lock-free ,
+            //        logFile. Shutdown  Critical-  .
+            //   ,      (   ).
+            static void SetAsyncMode ( bool enable, LogOverflowPolicy policy = LogOverflowPolicy::Drop,
+                                       size_t queueCapacity = 8192 );
+            static bool IsAsyncMode ();
+            static void Flush ();
+            static uint64_t GetDroppedMessageCount ();
+
+            //  sink:    ID  ,      .
+            //       LogDecoderTool. Error  Critical 
+            //  .      (  app.celog).
+            static void SetBinarySink ( bool enable, const std::string & fileName = "app.celog" );
+            static inline bool IsBinarySinkEnabled () { return binarySinkEnabled.load ( std::memory_order_relaxed ); }
+
+            template<typename... ArgTypes>
+            static void LogBinary ( LogFormatSite & site, LogLevel level, const char * category,
+                                    std::string_view format, const ArgTypes &... args )
+                {
+                static_assert( sizeof...( ArgTypes ) < 256, "Too many log arguments" );
+
+                uint32_t formatId = site.id.load ( std::memory_order_acquire );
+                if (formatId == 0)
+                    {
+                    formatId = RegisterFormat ( site, level, category, format );
+                    }
+
+                int64_t timestamp = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                    std::chrono::system_clock::now ().time_since_epoch () ).count ();
+
+                std::string record;
+                record.reserve ( 32 + 12 * sizeof...( ArgTypes ) );
+                BinaryLog::BeginMessageRecord ( record, formatId, timestamp, static_cast< uint8_t >( sizeof...( ArgTypes ) ) );
+                ( BinaryLog::AppendArg ( record, args ), ... );
+                WriteBinaryRecord ( level, std::move ( record ), false );
+                }
+
             // Core logger methods
             static inline void CoreTrace ( const std::string & message )
                 { if (ShouldLog ( LogLevel::Trace )) Log ( LogLevel::Trace, "[CORE] " + message ); }
@@ -73,18 +139,89 @@ namespace CE
 
     } // namespace CE
 
+//  ,    (0 = Trace ... 5 = Critical, 6 =  ).
+//      ((void)0)   .
+#define CE_LOG_LEVEL_TRACE    0
+#define CE_LOG_LEVEL_DEBUG    1
+#define CE_LOG_LEVEL_INFO     2
+#define CE_LOG_LEVEL_WARN     3
+#define CE_LOG_LEVEL_ERROR    4
+#define CE_LOG_LEVEL_CRITICAL 5
+#define CE_LOG_LEVEL_OFF      6
+
+#ifndef CE_LOG_COMPILE_LEVEL
+#ifdef _DEBUG
+#define CE_LOG_COMPILE_LEVEL CE_LOG_LEVEL_TRACE
+#else
+#define CE_LOG_COMPILE_LEVEL CE_LOG_LEVEL_INFO
+#endif
+#endif
+
+//    std::format,      .
+//    sink     Error  .
+#define CE_LOG_LAZY(Level, Function, Category, ...) \
+    do \
+        { \
+        if (::CE::Logger::ShouldLog ( Level )) \
+            { \
+            if (::CE::Logger::IsBinarySinkEnabled ()) \
+                { \
+                static ::CE::LogFormatSite ceLogSite; \
+                ::CE::Logger::LogBinary ( ceLogSite, Level, Category, __VA_ARGS__ ); \
+                if (Level >= ::CE::LogLevel::Error) ::CE::Logger::Function ( std::format ( __VA_ARGS__ ) ); \
+                } \
+            else \
+                { \
+                ::CE::Logger::Function ( std::format ( __VA_ARGS__ ) ); \
+                } \
+            } \
+        } while (0)
+
 //   Core 
-#define CE_CORE_TRACE(...)    ::CE::Logger::CoreTrace(std::format(__VA_ARGS__))
-#define CE_CORE_DEBUG(...)    ::CE::Logger::CoreDebug(std::format(__VA_ARGS__))
-#define CE_CORE_INFO(...)     ::CE::Logger::CoreInfo(std::format(__VA_ARGS__))
-#define CE_CORE_WARN(...)     ::CE::Logger::CoreWarn(std::format(__VA_ARGS__))
-#define CE_CORE_ERROR(...)    ::CE::Logger::CoreError(std::format(__VA_ARGS__))
-#define CE_CORE_CRITICAL(...) ::CE::Logger::CoreCritical(std::format(__VA_ARGS__))
-
-//   Client 
-#define CE_TRACE(...)         ::CE::Logger::ClientTrace(std::format(__VA_ARGS__))
-#define CE_DEBUG(...)         ::CE::Logger::ClientDebug(std::format(__VA_ARGS__))
-#define CE_INFO(...)          ::CE::Logger::ClientInfo(std::format(__VA_ARGS__))
-#define CE_WARN(...)          ::CE::Logger::ClientWarn(std::format(__VA_ARGS__))
-#define CE_ERROR(...)         ::CE::Logger::ClientError(std::format(__VA_ARGS__))
-#define CE_CRITICAL(...)      ::CE::Logger::ClientCritical(std::format(__VA_ARGS__))
\ No newline at end of file
+#if CE_LOG_COMPILE_LEVEL <= CE_LOG_LEVEL_TRACE
+#define CE_CORE_TRACE(...)    CE_LOG_LAZY(::CE::LogLevel::Trace, CoreTrace, "[CORE] ", __VA_ARGS__)
+#define CE_TRACE(...)         CE_LOG_LAZY(::CE::LogLevel::Trace, ClientTrace, "[APP] ", __VA_ARGS__)
+#else
+#define CE_CORE_TRACE(...)    ((void)0)
+#define CE_TRACE(...)         ((void)0)
+#endif
+
+#if CE_LOG_COMPILE_LEVEL <= CE_LOG_LEVEL_DEBUG
+#define CE_CORE_DEBUG(...)    CE_LOG_LAZY(::CE::LogLevel::Debug, CoreDebug, "[CORE] ", __VA_ARGS__)
+#define CE_DEBUG(...)         CE_LOG_LAZY(::CE::LogLevel::Debug, ClientDebug, "[APP] ", __VA_ARGS__)
+#else
+#define CE_CORE_DEBUG(...)    ((void)0)
+#define CE_DEBUG(...)         ((void)0)
+#endif
+
+#if CE_LOG_COMPILE_LEVEL <= CE_LOG_LEVEL_INFO
+#define CE_CORE_INFO(...)     CE_LOG_LAZY(::CE::LogLevel::Info, CoreInfo, "[CORE] ", __VA_ARGS__)
+#define CE_INFO(...)          CE_LOG_LAZY(::CE::LogLevel::Info, ClientInfo, "[APP] ", __VA_ARGS__)
+#else
+#define CE_CORE_INFO(...)     ((void)0)
+#define CE_INFO(...)          ((void)0)
+#endif
+
+#if CE_LOG_COMPILE_LEVEL <= CE_LOG_LEVEL_WARN
+#define CE_CORE_WARN(...)     CE_LOG_LAZY(::CE::LogLevel::Warn, CoreWarn, "[CORE] ", __VA_ARGS__)
+#define CE_WARN(...)          CE_LOG_LAZY(::CE::LogLevel::Warn, ClientWarn, "[APP] ", __VA_ARGS__)
+#else
+#define CE_CORE_WARN(...)     ((void)0)
+#define CE_WARN(...)          ((void)0)
+#endif
+
+#if CE_LOG_COMPILE_LEVEL <= CE_LOG_LEVEL_ERROR
+#define CE_CORE_ERROR(...)    CE_LOG_LAZY(::CE::LogLevel::Error, CoreError, "[CORE] ", __VA_ARGS__)
+#define CE_ERROR(...)         CE_LOG_LAZY(::CE::LogLevel::Error, ClientError, "[APP] ", __VA_ARGS__)
+#else
+#define CE_CORE_ERROR(...)    ((void)0)
+#define CE_ERROR(...)         ((void)0)
+#endif
+
+#if CE_LOG_COMPILE_LEVEL <= CE_LOG_LEVEL_CRITICAL
+#define CE_CORE_CRITICAL(...) CE_LOG_LAZY(::CE::LogLevel::Critical, CoreCritical, "[CORE] ", __VA_ARGS__)
+#define CE_CRITICAL(...)      CE_LOG_LAZY(::CE::LogLevel::Critical, ClientCritical, "[APP] ", __VA_ARGS__)
+#else
+#define CE_CORE_CRITICAL(...) ((void)0)
+#define CE_CRITICAL(...)      ((void)0)
+#endif
\ No newline at end of file
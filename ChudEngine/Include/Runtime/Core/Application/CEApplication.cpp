@@ -1,4 +1,5 @@
 #include "Core/Application/CEApplication.hpp"
+#include "Core/Memory/CEFrameAllocator.hpp"
 #include "Utils/Logger.hpp"
 
 namespace CE
@@ -34,6 +35,8 @@ namespace CE
 
         while (IsRunning && !Window->ShouldClose ())
             {
+            CEFrameAllocator::BeginFrame ();
+
                 // Calculate delta time
             double currentTime = glfwGetTime ();
             DeltaTime = static_cast< float >( currentTime - LastFrameTime );
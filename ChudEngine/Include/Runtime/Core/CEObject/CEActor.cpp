@@ -1,11 +1,11 @@
 #include "Core/CEObject/CEActor.hpp"
+#include "Core/CEObject/CEWorld.hpp"
 
 namespace CE
     {
     CEActor::CEActor ( const std::string & ActorName ) : CEObject ( ActorName )
         {       
         TransformComponent = CreateComponent<CETransformComponent> ();
-        TransformComponent->SetName ( Name + "_Transform" );
 
         CE_DEBUG ( " CEActor '{}' created (ID: {}) with transform", Name, UniqueID );
         bInitialized = true; 
@@ -45,10 +45,49 @@ namespace CE
             }
         }
 
-    void CEActor::RegisterComponent ( CEComponent * Component )
+    void CEActor::Reset ()
         {
-        std::type_index type = typeid( *Component );
-        ComponentMap[ type ].PushBack ( Component );
-        CE_DEBUG ( "Registered component of type {} for actor {}", type.name (), Name );
+        if (TransformComponent)
+            {
+            TransformComponent->SetParent ( nullptr );
+            TransformComponent->SetPosition ( Math::Vector3 ( 0.0f, 0.0f, 0.0f ) );
+            TransformComponent->SetRotation ( Math::Vector3 ( 0.0f, 0.0f, 0.0f ) );
+            TransformComponent->SetScale ( Math::Vector3 ( 1.0f, 1.0f, 1.0f ) );
+            }
+
+        for (auto & Component : Components)
+            {
+            Component->SetActive ( true );
+            }
+        }
+
+    void CEActor::PrepareForReuse ()
+        {
+        CEObject::bPendingKill = false;
+        CEObject::bInitialized = false;
+        bPendingKill = false;
+        bPendingWorldKill = false;
+        Reset ();
+        }
+
+    void CEActor::RegisterComponent ( CEComponent * Component, CEComponentTypeId TypeId )
+        {
+            //    :        
+        ComponentsByType.PushBack ( { TypeId, Component } );
+        for (uint64 i = ComponentsByType.Size () - 1; i > 0 && ComponentsByType[ i - 1 ].TypeId > TypeId; --i)
+            {
+            std::swap ( ComponentsByType[ i - 1 ], ComponentsByType[ i ] );
+            }
+
+        // ,   ,     
+        if (World)
+            {
+            World->RegisterComponent ( Component, TypeId );
+            if (Entity.IsValid ())
+                {
+                World->BindComponentEntity ( Component, Entity );
+                }
+            }
+        CE_DEBUG ( "Registered component {} (type ID {}) for actor {}", Component->GetName (), TypeId, Name );
         }
     }
\ No newline at end of file
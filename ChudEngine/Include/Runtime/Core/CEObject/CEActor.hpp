@@ -2,14 +2,14 @@
 
 #include "Utils/Logger.hpp"
 #include "Core/CEObject/CEObject.hpp"
+#include "Core/CEObject/CEClass.hpp"
 #include "Core/CEObject/Components/CEComponent.hpp"
 #include "Core/CEObject/Components/CETransformComponent.hpp"
 #include "Core/Containers/CEArray.hpp"
+#include "Core/ECS/CEEntity.hpp"
 #include <algorithm>
 #include <memory>
 #include <vector>
-#include <typeindex>
-#include <unordered_map>
 
 
 namespace CE
@@ -19,6 +19,10 @@ namespace CE
 
     class CEActor : public CEObject
         {
+        DECLARE_CLASS ( CEActor, CEObject )
+
+        friend class CEWorld;
+
         public:
             CEActor ( const std::string & ActorName = "CEActor" );
             virtual ~CEActor () override;
@@ -39,6 +43,16 @@ namespace CE
             virtual void BeginPlay () override;
             virtual void Tick ( float DeltaTime ) override;
 
+            //        CEWorld:      .
+            //       ;   .
+            virtual void Reset ();
+            bool IsPooled () const { return bPooled; }
+
+            // ,  BeginPlay        ( ,  
+            //   ),     BeginPlay   
+            void SetBeginPlayThreadSafe ( bool bThreadSafe ) { bBeginPlayThreadSafe = bThreadSafe; }
+            bool IsBeginPlayThreadSafe () const { return bBeginPlayThreadSafe; }
+
             template<typename T, typename... Args>
             T * CreateComponent ( Args&&... args )
                 {
@@ -48,7 +62,7 @@ namespace CE
                 //     
                 component->SetOwner ( this );
                 Components.push_back ( std::move ( component ) );
-                RegisterComponent ( rawPtr ); // :  
+                RegisterComponent ( rawPtr, GetComponentTypeId<T> () ); // :  
 
                 return rawPtr;
                 }
@@ -60,7 +74,7 @@ namespace CE
                 std::vector<T *> components;
                 for (auto & component : Components)
                     {
-                    if (auto * casted = dynamic_cast< T * >( component.get () ))
+                    if (T * casted = component->CastTo<T> ())
                         {
                         components.push_back ( casted );
                         }
@@ -72,15 +86,36 @@ namespace CE
             void SetTickManager ( CETickManager * InTickManager ) { TickManager = InTickManager; }
             void SetWorld ( CEWorld * InWorld ) { World = InWorld; }
 
+            //     (,    )
+            CEEntity GetEntity () const { return Entity; }
+
         protected:
+            struct CEComponentTypeEntry
+                {
+                CEComponentTypeId TypeId;
+                CEComponent * Component;
+
+                bool operator<( CEComponentTypeId OtherTypeId ) const { return TypeId < OtherTypeId; }
+                };
+
             std::vector<std::unique_ptr<CEComponent>> Components;
-            std::unordered_map<std::type_index, CEArray<CEComponent *>> ComponentMap;
+            //    ,   CEComponentTypeId (   ).
+            //       ,    ,    ;
+            //         
+            CEInlineArray<CEComponentTypeEntry, 4> ComponentsByType;
             CETransformComponent * TransformComponent = nullptr;
         private:
             CETickManager * TickManager = nullptr;
             CEWorld * World = nullptr;
+            CEEntity Entity;
+            uint32 WorldIndex = UINT32_MAX;   //   CEWorld::Actors,    O(1)
+            bool bPendingWorldKill = false;
+            bool bPooled = false;               //      ,   
+            bool bBeginPlayThreadSafe = false;
+
+            void PrepareForReuse ();
 
-            void RegisterComponent ( CEComponent * Component );
+            void RegisterComponent ( CEComponent * Component, CEComponentTypeId TypeId );
             bool IsInGame () const { return bInitialized && !bPendingKill; }
 
             //   
@@ -99,7 +134,7 @@ namespace CE
         NewComponent->SetOwner ( this );
 
         Components.push_back ( std::move ( NewComponent ) );
-        RegisterComponent ( ComponentPtr );
+        RegisterComponent ( ComponentPtr, GetComponentTypeId<T> () );
 
         if (IsInGame ())
             {
@@ -113,10 +148,11 @@ namespace CE
         {
         static_assert( std::is_base_of_v<CEComponent, T>, "T must inherit from CEComponent" );
 
-        auto it = ComponentMap.find ( typeid( T ) );
-        if (it != ComponentMap.end () && !it->second.IsEmpty ())
+        CEComponentTypeId typeId = GetComponentTypeId<T> ();
+        const CEComponentTypeEntry * entry = std::lower_bound ( ComponentsByType.begin (), ComponentsByType.end (), typeId );
+        if (entry != ComponentsByType.end () && entry->TypeId == typeId)
             {
-            return static_cast< T * >( it->second[ 0 ] );
+            return static_cast< T * >( entry->Component );
             }
         return nullptr;
         }
@@ -127,13 +163,11 @@ namespace CE
         static_assert( std::is_base_of_v<CEComponent, T>, "T must inherit from CEComponent" );
 
         CEArray<T *> Result;
-        auto it = ComponentMap.find ( typeid( T ) );
-        if (it != ComponentMap.end ())
+        CEComponentTypeId typeId = GetComponentTypeId<T> ();
+        for (const CEComponentTypeEntry * entry = std::lower_bound ( ComponentsByType.begin (), ComponentsByType.end (), typeId );
+             entry != ComponentsByType.end () && entry->TypeId == typeId; ++entry)
             {
-            for (CEComponent * Comp : it->second)
-                {
-                Result.PushBack ( static_cast< T * >( Comp ) );
-                }
+            Result.PushBack ( static_cast< T * >( entry->Component ) );
             }
         return Result;
         }
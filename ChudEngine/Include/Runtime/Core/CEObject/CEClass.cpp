@@ -0,0 +1,175 @@
+#include "Core/CEObject/CEClass.hpp"
+
+namespace CE
+    {
+    namespace
+        {
+        //    .   ,  StaticClass
+        //          
+        struct CEClassTree
+            {
+            std::mutex Mutex;
+            std::vector<CEClass *> RootClasses;
+            std::vector<CEClass *> PreOrder; // PreOrder[ Class->GetClassBegin () ] == Class
+            };
+
+        CEClassTree & GetClassTree ()
+            {
+            static CEClassTree Tree;
+            return Tree;
+            }
+        }
+
+    CEClass::CEClass ( const std::string & InClassName, CEClass * InSuperClass )
+        : CEObject ( InClassName, CEClassObjectTag {} ), ClassName ( InClassName ), SuperClass ( InSuperClass )
+        {
+        RegisterClass ( this );
+        CE_DEBUG ( "CEClass '{}' registered (range: [{}, {}))", ClassName, GetClassBegin (), GetClassEnd () );
+        }
+
+    size_t CEClass::GetInstanceCount () const
+        {
+        EnableInstanceTracking ();
+
+        std::lock_guard<std::mutex> lock ( InstancesMutex );
+        return Instances.size ();
+        }
+
+    void CEClass::RegisterClass ( CEClass * Class )
+        {
+        CEClassTree & tree = GetClassTree ();
+        std::lock_guard<std::mutex> lock ( tree.Mutex );
+
+        if (Class->SuperClass)
+            {
+            Class->SuperClass->SubClasses.push_back ( Class );
+            }
+        else
+            {
+            tree.RootClasses.push_back ( Class );
+            }
+        RenumberClasses ();
+        }
+
+    void CEClass::RenumberClasses ()
+        {
+            //    .    IsChildOf,   
+        CEClassTree & tree = GetClassTree ();
+        uint32 version = TreeVersion.load ( std::memory_order_relaxed );
+        TreeVersion.store ( version + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence ( std::memory_order_release );
+
+        tree.PreOrder.clear ();
+        std::vector<std::pair<CEClass *, size_t>> stack; //     
+        for (CEClass * root : tree.RootClasses)
+            {
+            stack.emplace_back ( root, 0 );
+            root->ClassBegin.store ( static_cast< uint32 >( tree.PreOrder.size () ), std::memory_order_relaxed );
+            tree.PreOrder.push_back ( root );
+
+            while (!stack.empty ())
+                {
+                auto & [current, nextChild] = stack.back ();
+                if (nextChild < current->SubClasses.size ())
+                    {
+                    CEClass * child = current->SubClasses[ nextChild++ ];
+                    child->ClassBegin.store ( static_cast< uint32 >( tree.PreOrder.size () ), std::memory_order_relaxed );
+                    tree.PreOrder.push_back ( child );
+                    stack.emplace_back ( child, 0 );
+                    }
+                else
+                    {
+                    current->ClassEnd.store ( static_cast< uint32 >( tree.PreOrder.size () ), std::memory_order_relaxed );
+                    stack.pop_back ();
+                    }
+                }
+            }
+
+        TreeVersion.store ( version + 2, std::memory_order_release );
+        }
+
+    void CEClass::EnableInstanceTracking ()
+        {
+        if (bTrackInstances.load ( std::memory_order_acquire )) return;
+
+        std::unique_lock<std::shared_mutex> trackingLock ( InstanceTrackingMutex );
+        if (bTrackInstances.load ( std::memory_order_relaxed )) return;
+
+            //    : ,     ,  ,
+            //         
+        bTrackInstances.store ( true );
+        for (CEObject::CEObjectRegistryShard & shard : CEObject::RegistryShards)
+            {
+            std::lock_guard<std::mutex> shardLock ( shard.Mutex );
+            for (auto & [ id, object ] : shard.Objects)
+                {
+                CEClass * objectClass = object->ObjectClass.load ();
+                if (objectClass)
+                    {
+                    AddInstanceLocked ( objectClass, object );
+                    }
+                }
+            }
+        }
+
+    void CEClass::LinkInstance ( CEObject * Object )
+        {
+        if (!bTrackInstances.load ()) return;
+
+        std::shared_lock<std::shared_mutex> trackingLock ( InstanceTrackingMutex );
+        CEClass * objectClass = Object->ObjectClass.load ( std::memory_order_relaxed );
+        if (Object->InstanceListClass == objectClass) return;
+
+        RemoveInstanceLocked ( Object );
+        AddInstanceLocked ( objectClass, Object );
+        }
+
+    void CEClass::RemoveInstance ( CEObject * Object )
+        {
+        if (!bTrackInstances.load ()) return;
+
+        std::shared_lock<std::shared_mutex> trackingLock ( InstanceTrackingMutex );
+        RemoveInstanceLocked ( Object );
+        }
+
+    void CEClass::AddInstanceLocked ( CEClass * Class, CEObject * Object )
+        {
+        std::lock_guard<std::mutex> lock ( Class->InstancesMutex );
+        Object->InstanceListClass = Class;
+        Object->ObjectClassSlot = static_cast< uint32 >( Class->Instances.size () );
+        Class->Instances.push_back ( Object );
+        }
+
+    void CEClass::RemoveInstanceLocked ( CEObject * Object )
+        {
+        CEClass * Class = Object->InstanceListClass;
+        if (!Class) return;
+
+        std::lock_guard<std::mutex> lock ( Class->InstancesMutex );
+
+            // swap-and-pop   
+        CEObject * last = Class->Instances.back ();
+        Class->Instances[ Object->ObjectClassSlot ] = last;
+        last->ObjectClassSlot = Object->ObjectClassSlot;
+        Class->Instances.pop_back ();
+        Object->InstanceListClass = nullptr;
+        }
+
+    void CEClass::CollectInstances ( const CEClass * Class, std::vector<CEObject *> & OutObjects )
+        {
+        EnableInstanceTracking ();
+
+        CEClassTree & tree = GetClassTree ();
+        std::lock_guard<std::mutex> treeLock ( tree.Mutex );
+
+            //    PreOrder   
+        uint32 begin = Class->GetClassBegin ();
+        uint32 end = Class->GetClassEnd ();
+        for (uint32 i = begin; i < end; ++i)
+            {
+            CEClass * current = tree.PreOrder[ i ];
+            std::lock_guard<std::mutex> lock ( current->InstancesMutex );
+            OutObjects.insert ( OutObjects.end (), current->Instances.begin (), current->Instances.end () );
+            }
+        }
+    }
@@ -4,6 +4,9 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 
 namespace CE
     {
@@ -23,26 +26,96 @@ namespace CE
                 return new T ();
                 }
 
-                //  
-            bool IsChildOf ( const CEClass * OtherClass ) const;
+                //    O(1):       ,
+                //     [ClassBegin, ClassEnd)
+            bool IsChildOf ( const CEClass * OtherClass ) const
+                {
+                if (!OtherClass) return false;
+
+                for (;;)
+                    {
+                        //        -   seqlock
+                    uint32 version = TreeVersion.load ( std::memory_order_acquire );
+                    if (( version & 1 ) == 0)
+                        {
+                        uint32 begin = ClassBegin.load ( std::memory_order_relaxed );
+                        uint32 otherBegin = OtherClass->ClassBegin.load ( std::memory_order_relaxed );
+                        uint32 otherEnd = OtherClass->ClassEnd.load ( std::memory_order_relaxed );
+                        std::atomic_thread_fence ( std::memory_order_acquire );
+                        if (TreeVersion.load ( std::memory_order_relaxed ) == version)
+                            {
+                            return otherBegin <= begin && begin < otherEnd;
+                            }
+                        }
+                    }
+                }
+
+            uint32 GetClassBegin () const { return ClassBegin.load ( std::memory_order_relaxed ); }
+            uint32 GetClassEnd () const { return ClassEnd.load ( std::memory_order_relaxed ); }
+
+            //     ( ).      
+            size_t GetInstanceCount () const;
 
         private:
+            friend class CEObject;
+
             std::string ClassName;
             CEClass * SuperClass;
+            std::vector<CEClass *> SubClasses;
+
+            //        
+            std::atomic<uint32> ClassBegin { 0 };
+            std::atomic<uint32> ClassEnd { 0 };
+
+            //   :      ObjectClassSlot
+            mutable std::mutex InstancesMutex;
+            std::vector<CEObject *> Instances;
+
+            static inline std::atomic<uint32> TreeVersion { 0 };
+
+            //     ,    ObjectClass,  .
+            //           ,
+            //    DECLARE_CLASS    
+            static inline std::atomic<bool> bTrackInstances { false };
+            static inline std::shared_mutex InstanceTrackingMutex;
+
+            static void RegisterClass ( CEClass * Class );
+            static void RenumberClasses ();
+            static void EnableInstanceTracking ();
+            static void LinkInstance ( CEObject * Object );
+            static void RemoveInstance ( CEObject * Object );
+            static void AddInstanceLocked ( CEClass * Class, CEObject * Object );
+            static void RemoveInstanceLocked ( CEObject * Object );
+            static void CollectInstances ( const CEClass * Class, std::vector<CEObject *> & OutObjects );
+        };
+
+    inline bool CEObject::IsA ( const CEClass * Class ) const
+        {
+        const CEClass * objectClass = GetClass ();
+        return objectClass && objectClass->IsChildOf ( Class );
+        }
+
+        //      DECLARE_CLASS;    .
+        //    ,      .  
+        //  CE_NO_UNIQUE_ADDRESS,      .
+    class CEClassRegistrar
+        {
+        public:
+            CEClassRegistrar ( CEObject * Object, CEClass * Class ) { CEObject::SetObjectClass ( Object, Class ); }
         };
 
         //     (  UE)
 #define DECLARE_CLASS(ClassName, SuperClassName) \
     public: \
+        using ThisClass = ClassName; \
         static CEClass* StaticClass() { \
-            static CEClass* Class = nullptr; \
-            if (!Class) { \
-                Class = new CEClass(#ClassName, SuperClassName::StaticClass()); \
-            } \
+            static CEClass* Class = new CEClass(#ClassName, SuperClassName::StaticClass()); \
             return Class; \
         } \
-        virtual CEClass* GetClass() const override { return StaticClass(); }
+    private: \
+        CE_NO_UNIQUE_ADDRESS CEClassRegistrar ClassRegistrar_##ClassName { this, StaticClass() }; \
+    public:
 
     //    
 #define IMPLEMENT_CLASS(ClassName)
-    }
\ No newline at end of file
+    }
@@ -0,0 +1,183 @@
+#include "Core/CEObject/CEConcurrentEventQueue.hpp"
+#include <unordered_map>
+
+namespace CE
+    {
+    namespace
+        {
+        std::atomic<uint64> NextQueueSerial { 1 };
+
+        // Producer block this thread owns in each queue it has pushed to. Entries are never evicted:
+        // a second producer for the same thread would cost a chunk and break per-thread FIFO order.
+        // Keyed by serial, not address, so a queue recreated at the same address is not confused;
+        // entries of destroyed queues stay behind but are never matched again.
+        struct CEProducerLookup
+            {
+            uint64 LastSerial = 0;
+            void * LastProducer = nullptr;
+            std::unordered_map<uint64, void *> Producers;
+            };
+
+        thread_local CEProducerLookup ProducerLookup;
+        }
+
+    CEConcurrentEventQueue::CEConcurrentEventQueue ()
+        : Serial ( NextQueueSerial.fetch_add ( 1, std::memory_order_relaxed ) )
+        {
+        }
+
+    CEConcurrentEventQueue::~CEConcurrentEventQueue ()
+        {
+            // Undrained events are destroyed, then every chunk is freed
+        CEEventProducer * producer = Producers.load ( std::memory_order_acquire );
+        while (producer)
+            {
+            DrainProducer ( *producer, nullptr );
+
+            CEEventChunk * chunk = producer->ReadChunk;
+            while (chunk)
+                {
+                CEEventChunk * next = chunk->Next.load ( std::memory_order_relaxed );
+                delete chunk;
+                chunk = next;
+                }
+
+            CEEventChunk * freeChunk = producer->LocalFreeChunks;
+            while (freeChunk)
+                {
+                CEEventChunk * next = freeChunk->NextFree;
+                delete freeChunk;
+                freeChunk = next;
+                }
+            freeChunk = producer->ReturnedChunks.load ( std::memory_order_relaxed );
+            while (freeChunk)
+                {
+                CEEventChunk * next = freeChunk->NextFree;
+                delete freeChunk;
+                freeChunk = next;
+                }
+
+            CEEventProducer * nextProducer = producer->NextProducer;
+            delete producer;
+            producer = nextProducer;
+            }
+        }
+
+    CEConcurrentEventQueue::CEEventProducer & CEConcurrentEventQueue::GetProducer ()
+        {
+        CEProducerLookup & lookup = ProducerLookup;
+        if (lookup.LastSerial == Serial)
+            {
+            return *static_cast< CEEventProducer * >( lookup.LastProducer );
+            }
+
+        void *& cached = lookup.Producers[ Serial ];
+        if (!cached)
+            {
+                // First push from this thread: register a producer block
+            CEEventProducer * producer = new CEEventProducer ();
+            producer->WriteChunk = new CEEventChunk ();
+            producer->ReadChunk = producer->WriteChunk;
+
+            CEEventProducer * head = Producers.load ( std::memory_order_relaxed );
+            do
+                {
+                producer->NextProducer = head;
+                }
+            while (!Producers.compare_exchange_weak ( head, producer, std::memory_order_release, std::memory_order_relaxed ));
+
+            cached = producer;
+            }
+
+        lookup.LastSerial = Serial;
+        lookup.LastProducer = cached;
+        return *static_cast< CEEventProducer * >( cached );
+        }
+
+    CEConcurrentEventQueue::CEEventChunk * CEConcurrentEventQueue::AcquireChunk ( CEEventProducer & Producer )
+        {
+        if (!Producer.LocalFreeChunks)
+            {
+            Producer.LocalFreeChunks = Producer.ReturnedChunks.exchange ( nullptr, std::memory_order_acquire );
+            }
+
+        CEEventChunk * chunk = Producer.LocalFreeChunks;
+        if (chunk)
+            {
+            Producer.LocalFreeChunks = chunk->NextFree;
+            chunk->NextFree = nullptr;
+            chunk->Committed.store ( 0, std::memory_order_relaxed );
+            chunk->Next.store ( nullptr, std::memory_order_relaxed );
+            return chunk;
+            }
+        return new CEEventChunk ();
+        }
+
+    void * CEConcurrentEventQueue::BeginRecord ( CEEventProducer & Producer, CEEventDrainFunction Drain, uint32 RecordSize )
+        {
+        if (Producer.WriteOffset + RecordSize > CHUNK_BYTES)
+            {
+                // The old chunk is final once Next is published; the consumer reads its last commit after that
+            CEEventChunk * chunk = AcquireChunk ( Producer );
+            Producer.WriteChunk->Next.store ( chunk, std::memory_order_release );
+            Producer.WriteChunk = chunk;
+            Producer.WriteOffset = 0;
+            }
+
+        unsigned char * record = Producer.WriteChunk->Data + Producer.WriteOffset;
+        CERecordHeader * header = reinterpret_cast< CERecordHeader * >( record );
+        header->Drain = Drain;
+        header->Size = RecordSize;
+        return record + HEADER_SIZE;
+        }
+
+    void CEConcurrentEventQueue::EndRecord ( CEEventProducer & Producer, uint32 RecordSize )
+        {
+        Producer.WriteOffset += RecordSize;
+        Producer.WriteChunk->Committed.store ( Producer.WriteOffset, std::memory_order_release );
+        }
+
+    uint64 CEConcurrentEventQueue::Drain ( CEEventSystem * System )
+        {
+        uint64 drained = 0;
+        for (CEEventProducer * producer = Producers.load ( std::memory_order_acquire ); producer; producer = producer->NextProducer)
+            {
+            drained += DrainProducer ( *producer, System );
+            }
+        return drained;
+        }
+
+    uint64 CEConcurrentEventQueue::DrainProducer ( CEEventProducer & Producer, CEEventSystem * System )
+        {
+        uint64 drained = 0;
+        while (true)
+            {
+            CEEventChunk * chunk = Producer.ReadChunk;
+            CEEventChunk * next = chunk->Next.load ( std::memory_order_acquire );
+            uint32 committed = chunk->Committed.load ( std::memory_order_acquire );
+
+            while (Producer.ReadOffset < committed)
+                {
+                unsigned char * record = chunk->Data + Producer.ReadOffset;
+                const CERecordHeader * header = reinterpret_cast< const CERecordHeader * >( record );
+                header->Drain ( System, record + HEADER_SIZE );
+                Producer.ReadOffset += header->Size;
+                ++drained;
+                }
+
+            if (!next) break;
+
+            // Chunk fully consumed and abandoned by the producer: hand it back
+            Producer.ReadChunk = next;
+            Producer.ReadOffset = 0;
+
+            CEEventChunk * head = Producer.ReturnedChunks.load ( std::memory_order_relaxed );
+            do
+                {
+                chunk->NextFree = head;
+                }
+            while (!Producer.ReturnedChunks.compare_exchange_weak ( head, chunk, std::memory_order_release, std::memory_order_relaxed ));
+            }
+        return drained;
+        }
+    }
@@ -0,0 +1,95 @@
+// Runtime/Core/CEObject/CEConcurrentEventQueue.hpp
+#pragma once
+#include "Core/CoreTypes.hpp"
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CE
+    {
+    class CEEventSystem;
+
+    // Moves the payload into System (or only destroys it when System is null)
+    using CEEventDrainFunction = void ( * )( CEEventSystem * System, void * Payload );
+
+    // Lock-free multi-producer / single-consumer queue of type-erased events.
+    // Every producer thread appends to its own chain of chunks (no shared cache lines on the hot path)
+    // and publishes each record with a release store of the chunk's commit offset.
+    // The consumer (game thread) walks all producers in Drain and hands finished chunks back for reuse.
+    class CEConcurrentEventQueue
+        {
+        public:
+            static constexpr uint32 CHUNK_BYTES = 16 * 1024;
+            static constexpr uint32 RECORD_ALIGNMENT = 16;
+
+            CEConcurrentEventQueue ();
+            ~CEConcurrentEventQueue ();
+
+            CEConcurrentEventQueue ( const CEConcurrentEventQueue & ) = delete;
+            CEConcurrentEventQueue & operator=( const CEConcurrentEventQueue & ) = delete;
+
+            // Any thread
+            template<typename EventType, typename... ArgTypes>
+            void Push ( CEEventDrainFunction Drain, ArgTypes &&... Args )
+                {
+                static_assert( alignof( EventType ) <= RECORD_ALIGNMENT, "Event is over-aligned for CEConcurrentEventQueue" );
+                static_assert( HEADER_SIZE + sizeof ( EventType ) <= CHUNK_BYTES, "Event does not fit into a queue chunk" );
+
+                constexpr uint32 recordSize = AlignRecord ( HEADER_SIZE + sizeof ( EventType ) );
+                CEEventProducer & producer = GetProducer ();
+                void * payload = BeginRecord ( producer, Drain, recordSize );
+                new ( payload ) EventType ( std::forward<ArgTypes> ( Args )... );
+                EndRecord ( producer, recordSize );
+                }
+
+            // Consumer thread only. Returns the number of events handed to System.
+            uint64 Drain ( CEEventSystem * System );
+
+        private:
+            struct CERecordHeader
+                {
+                CEEventDrainFunction Drain;
+                uint32 Size;
+                };
+
+            struct CEEventChunk
+                {
+                std::atomic<uint32> Committed { 0 };
+                std::atomic<CEEventChunk *> Next { nullptr };
+                CEEventChunk * NextFree = nullptr;
+                alignas( RECORD_ALIGNMENT ) unsigned char Data[ CHUNK_BYTES ];
+                };
+
+                // Producer and consumer fields sit on separate cache lines
+            struct alignas( 64 ) CEEventProducer
+                {
+                    // Written by the owning thread
+                CEEventChunk * WriteChunk = nullptr;
+                uint32 WriteOffset = 0;
+                CEEventChunk * LocalFreeChunks = nullptr;
+                std::atomic<CEEventChunk *> ReturnedChunks { nullptr }; // consumer pushes, producer takes all
+                CEEventProducer * NextProducer = nullptr;
+
+                // Written by the consumer
+                alignas( 64 ) CEEventChunk * ReadChunk = nullptr;
+                uint32 ReadOffset = 0;
+                };
+
+            static constexpr uint32 AlignRecord ( size_t Size )
+                {
+                return static_cast< uint32 >( ( Size + RECORD_ALIGNMENT - 1 ) & ~static_cast< size_t >( RECORD_ALIGNMENT - 1 ) );
+                }
+
+            static constexpr uint32 HEADER_SIZE = ( sizeof ( CERecordHeader ) + RECORD_ALIGNMENT - 1 ) & ~( RECORD_ALIGNMENT - 1 );
+
+            void * BeginRecord ( CEEventProducer & Producer, CEEventDrainFunction Drain, uint32 RecordSize );
+            void EndRecord ( CEEventProducer & Producer, uint32 RecordSize );
+            CEEventProducer & GetProducer ();
+            CEEventChunk * AcquireChunk ( CEEventProducer & Producer );
+            uint64 DrainProducer ( CEEventProducer & Producer, CEEventSystem * System );
+
+            std::atomic<CEEventProducer *> Producers { nullptr };
+            uint64 Serial;
+        };
+    }
@@ -1,6 +1,6 @@
 #pragma once
 #include "Core/CEObject/CEObject.hpp"
-#include <functional>
+#include "Core/CEObject/CEInlineFunction.hpp"
 #include <vector>
 #include <memory>
 
@@ -20,7 +20,7 @@ namespace CE
     class CEDelegate : public CEDelegateBase
         {
         public:
-            using FunctionType = std::function<void ( T )>;
+            using FunctionType = CEInlineFunction<void ( T )>;
 
             CEDelegate ()
                 {
@@ -30,7 +30,7 @@ namespace CE
                 //  
             void Bind ( FunctionType Function )
                 {
-                Functions.push_back ( Function );
+                Functions.push_back ( std::move ( Function ) );
                 CE_DEBUG ( "Delegate '{}' bound new function (total: {})", GetName (), Functions.size () );
                 }
 
@@ -38,10 +38,8 @@ namespace CE
             template<typename ClassType>
             void Bind ( ClassType * Object, void ( ClassType:: * Method )( T ) )
                 {
-                Functions.push_back ( [ Object, Method ] ( T Arg )
-                                      {
-                                      if (Object) ( Object->*Method )( Arg );
-                                      } );
+                if (!Object) return;
+                Functions.push_back ( FunctionType::FromMethod ( Object, Method ) );
                 CE_DEBUG ( "Delegate '{}' bound object method (total: {})", GetName (), Functions.size () );
                 }
 
@@ -54,8 +52,6 @@ namespace CE
                     {
                     if (Function) Function ( Arg );
                     }
-
-                CE_DEBUG ( "Delegate '{}' broadcast to {} functions", GetName (), Functions.size () );
                 }
 
                 //  
@@ -79,7 +75,7 @@ namespace CE
     class CEMulticastDelegate : public CEDelegateBase
         {
         public:
-            using FunctionType = std::function<void ()>;
+            using FunctionType = CEInlineFunction<void ()>;
 
             CEMulticastDelegate ()
                 {
@@ -89,7 +85,7 @@ namespace CE
                 //  
             void Add ( FunctionType Function )
                 {
-                Functions.push_back ( Function );
+                Functions.push_back ( std::move ( Function ) );
                 CE_DEBUG ( "MulticastDelegate '{}' added function (total: {})", GetName (), Functions.size () );
                 }
 
@@ -97,10 +93,8 @@ namespace CE
             template<typename ClassType>
             void Add ( ClassType * Object, void ( ClassType:: * Method )( ) )
                 {
-                Functions.push_back ( [ Object, Method ] ()
-                                      {
-                                      if (Object) ( Object->*Method )( );
-                                      } );
+                if (!Object) return;
+                Functions.push_back ( FunctionType::FromMethod ( Object, Method ) );
                 CE_DEBUG ( "MulticastDelegate '{}' added object method (total: {})", GetName (), Functions.size () );
                 }
 
@@ -113,8 +107,6 @@ namespace CE
                     {
                     if (Function) Function ();
                     }
-
-                CE_DEBUG ( "MulticastDelegate '{}' broadcast to {} functions", GetName (), Functions.size () );
                 }
 
             virtual void Clear () override
@@ -137,7 +129,7 @@ namespace CE
     class CEMulticastDelegate1 : public CEDelegateBase
         {
         public:
-            using FunctionType = std::function<void ( T )>;
+            using FunctionType = CEInlineFunction<void ( T )>;
 
             CEMulticastDelegate1 ()
                 {
@@ -146,17 +138,15 @@ namespace CE
 
             void Add ( FunctionType Function )
                 {
-                Functions.push_back ( Function );
+                Functions.push_back ( std::move ( Function ) );
                 CE_DEBUG ( "MulticastDelegate1 '{}' added function (total: {})", GetName (), Functions.size () );
                 }
 
             template<typename ClassType>
             void Add ( ClassType * Object, void ( ClassType:: * Method )( T ) )
                 {
-                Functions.push_back ( [ Object, Method ] ( T Arg )
-                                      {
-                                      if (Object) ( Object->*Method )( Arg );
-                                      } );
+                if (!Object) return;
+                Functions.push_back ( FunctionType::FromMethod ( Object, Method ) );
                 CE_DEBUG ( "MulticastDelegate1 '{}' added object method (total: {})", GetName (), Functions.size () );
                 }
 
@@ -168,8 +158,6 @@ namespace CE
                     {
                     if (Function) Function ( Arg );
                     }
-
-                CE_DEBUG ( "MulticastDelegate1 '{}' broadcast to {} functions", GetName (), Functions.size () );
                 }
 
             virtual void Clear () override
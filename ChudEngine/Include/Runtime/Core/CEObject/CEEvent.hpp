@@ -1,13 +1,31 @@
 #pragma once
-#include "Core/CEObject/CEObject.hpp"
+#include "Core/CoreTypes.hpp"
 
 namespace CE
     {
-        //     
-    class CEEvent : public CEObject
+        //    - FNV-1a  ,    
+    using CEEventId = uint32;
+
+    constexpr CEEventId CEHashEventName ( const char * Name )
+        {
+        uint32 hash = 2166136261u;
+        while (*Name)
+            {
+            hash ^= static_cast< uint8 >( *Name++ );
+            hash *= 16777619u;
+            }
+        return hash;
+        }
+
+        //     .
+        //  -  :     ,  CEObject  shared_ptr.
+    struct CEEvent
         {
-        public:
-            CEEvent () = default;
-            virtual ~CEEvent () = default;
         };
+
+        //  : DECLARE_EVENT(HitEvent)  - CEEvent
+#define DECLARE_EVENT(EventName) \
+    public: \
+        static constexpr const char* StaticEventName = #EventName; \
+        static constexpr CEEventId StaticEventId = CEHashEventName(#EventName);
     }
\ No newline at end of file
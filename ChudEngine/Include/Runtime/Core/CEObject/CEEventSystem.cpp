@@ -16,20 +16,79 @@ namespace CE
         CE_DEBUG ( "CEEventSystem destroyed" );
         }
 
-    void CEEventSystem::UnregisterAllHandlers ( const std::string & EventName )
+    void CEEventSystem::DispatchQueuedEvents ()
         {
-        auto it = EventDelegates.find ( EventName );
-        if (it != EventDelegates.end ())
+            //       
+        ConcurrentQueue.Drain ( this );
+
+        ++DispatchDepth;
+        uint32 pass = 0;
+        while (!ActiveChannels.empty ())
             {
-            it->second->Clear ();
-            EventDelegates.erase ( it );
-            CE_DEBUG ( "EventSystem: Unregistered all handlers for event '{}'", EventName );
+            if (pass++ == MAX_DISPATCH_PASSES)
+                {
+                CE_WARN ( "EventSystem: events are still being queued after {} dispatch passes, {} types deferred to next frame",
+                          MAX_DISPATCH_PASSES, ActiveChannels.size () );
+                break;
+                }
+
+            DispatchingChannels.swap ( ActiveChannels );
+            for (CEEventChannelBase * channel : DispatchingChannels)
+                {
+                channel->DispatchQueue ();
+                }
+            DispatchingChannels.clear ();
+            }
+        EndDispatch ();
+        }
+
+    void CEEventSystem::EndDispatch ()
+        {
+        if (--DispatchDepth > 0 || !bReleaseChannelsPending) return;
+
+            // ,     Clear, 
+        bReleaseChannelsPending = false;
+        std::erase_if ( Channels, [] ( const auto & Entry ) { return Entry.second->IsEmpty (); } );
+        }
+
+    size_t CEEventSystem::GetQueuedEventCount () const
+        {
+        size_t count = 0;
+        for (const CEEventChannelBase * channel : ActiveChannels)
+            {
+            count += channel->GetQueuedCount ();
+            }
+        return count;
+        }
+
+    void CEEventSystem::UnregisterAllHandlers ( CEEventId EventId )
+        {
+        auto it = Channels.find ( EventId );
+        if (it != Channels.end ())
+            {
+                //   :         
+            it->second->ClearHandlers ();
+            CE_DEBUG ( "EventSystem: Unregistered all handlers for event '{}'", it->second->EventName );
             }
         }
 
     void CEEventSystem::Clear ()
         {
-        EventDelegates.clear ();
+        if (DispatchDepth > 0)
+            {
+            for (auto & [ eventId, channel ] : Channels)
+                {
+                channel->ClearHandlers ();
+                channel->ClearQueue ();
+                }
+            ActiveChannels.clear ();
+            bReleaseChannelsPending = true;
+            CE_DEBUG ( "EventSystem: Cleared all event handlers, channels are released after the dispatch" );
+            return;
+            }
+
+        ActiveChannels.clear ();
+        Channels.clear ();
         CE_DEBUG ( "EventSystem: Cleared all event handlers" );
         }
-    }
\ No newline at end of file
+    }
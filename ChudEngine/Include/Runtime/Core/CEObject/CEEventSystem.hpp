@@ -1,77 +1,251 @@
 #pragma once
 
 #include "Core/CEObject/CEObject.hpp"
-#include "Core/CEObject/CEDelegate.hpp"
-#include "Core/CEObject/CEEvent.hpp" 
+#include "Core/CEObject/CEEvent.hpp"
+#include "Core/CEObject/CEInlineFunction.hpp"
+#include "Core/CEObject/CEConcurrentEventQueue.hpp"
 #include <unordered_map>
-#include <string>
+#include <vector>
 #include <memory>
+#include <type_traits>
 
 namespace CE
     {
-        //   
+        //   .
+        //    CEEventId (  ),       .
+        // BroadcastEvent   , QueueEvent    DispatchQueuedEvents
+        // (CEWorld      ,  ).
     class CEEventSystem : public CEObject
         {
         public:
+            template<typename EventType>
+            using HandlerType = CEInlineFunction<void ( const EventType & )>;
+
+            //   DispatchQueuedEvents  ,     
+            static constexpr uint32 MAX_DISPATCH_PASSES = 8;
+
             CEEventSystem ();
             virtual ~CEEventSystem ();
 
             //   
             template<typename EventType>
-            void RegisterHandler ( const std::string & EventName, std::function<void ( std::shared_ptr<EventType> )> Handler )
+            void RegisterHandler ( HandlerType<EventType> Handler )
                 {
-                auto delegate = GetOrCreateDelegate<EventType> ( EventName );
-                delegate->Bind ( Handler );
-                CE_DEBUG ( "EventSystem: Registered handler for event '{}'", EventName );
+                GetOrCreateChannel<EventType> ()->AddHandler ( std::move ( Handler ) );
+                CE_DEBUG ( "EventSystem: Registered handler for event '{}'", EventType::StaticEventName );
                 }
 
             template<typename EventType, typename ClassType>
-            void RegisterHandler ( const std::string & EventName, ClassType * Object, void ( ClassType:: * Method )( std::shared_ptr<EventType> ) )
+            void RegisterHandler ( ClassType * Object, void ( ClassType:: * Method )( const EventType & ) )
                 {
-                auto delegate = GetOrCreateDelegate<EventType> ( EventName );
-                delegate->Bind ( Object, Method );
-                CE_DEBUG ( "EventSystem: Registered object handler for event '{}'", EventName );
+                if (!Object) return;
+                GetOrCreateChannel<EventType> ()->AddHandler ( HandlerType<EventType>::FromMethod ( Object, Method ) );
+                CE_DEBUG ( "EventSystem: Registered object handler for event '{}'", EventType::StaticEventName );
                 }
 
-                //  
+                //  
             template<typename EventType>
-            void BroadcastEvent ( const std::string & EventName, std::shared_ptr<EventType> Event )
+            void BroadcastEvent ( const EventType & Event )
                 {
-                auto it = EventDelegates.find ( EventName );
-                if (it != EventDelegates.end ())
+                if (auto * channel = FindChannel<EventType> ())
                     {
-                    if (auto delegate = std::dynamic_pointer_cast< CEDelegate<std::shared_ptr<EventType>> >( it->second ))
-                        {
-                        delegate->Broadcast ( Event );
-                        CE_DEBUG ( "EventSystem: Broadcast event '{}' to {} handlers",
-                                  EventName, delegate->GetNumBindings () );
-                        }
+                    ++DispatchDepth;
+                    channel->Broadcast ( Event );
+                    EndDispatch ();
                     }
-                else
+                }
+
+                //  :          DispatchQueuedEvents
+            template<typename EventType, typename... ArgTypes>
+            void QueueEvent ( ArgTypes &&... Args )
+                {
+                auto * channel = GetOrCreateChannel<EventType> ();
+                if (channel->Queue.empty ())
                     {
-                    CE_WARN ( "EventSystem: No handlers registered for event '{}'", EventName );
+                    ActiveChannels.push_back ( channel );
                     }
+                channel->Queue.emplace_back ( std::forward<ArgTypes> ( Args )... );
+                }
+
+            template<typename EventType>
+            void QueueEvent ( const EventType & Event )
+                {
+                QueueEvent<EventType, const EventType &> ( Event );
+                }
+
+                //    (     CEJobSystem):    
+                //  lock-free ,  DispatchQueuedEvents      
+            template<typename EventType, typename... ArgTypes>
+            void QueueEventConcurrent ( ArgTypes &&... Args )
+                {
+                static_assert( std::is_base_of_v<CEEvent, EventType>, "EventType must inherit from CEEvent" );
+                ConcurrentQueue.Push<EventType> ( &DrainConcurrentEvent<EventType>, std::forward<ArgTypes> ( Args )... );
+                }
+
+                //     ,   
+            void DispatchQueuedEvents ();
+            size_t GetQueuedEventCount () const; //  ,     ConcurrentQueue
+
+            //  
+            template<typename EventType>
+            void UnregisterAllHandlers ()
+                {
+                UnregisterAllHandlers ( EventType::StaticEventId );
                 }
 
-                //  
-            void UnregisterAllHandlers ( const std::string & EventName );
+            void UnregisterAllHandlers ( CEEventId EventId );
+
+            //      .       :
+            //   ,       
             void Clear ();
 
         private:
-            std::unordered_map<std::string, std::shared_ptr<CEDelegateBase>> EventDelegates;
+            struct CEEventChannelBase
+                {
+                virtual ~CEEventChannelBase () = default;
+                virtual void DispatchQueue () = 0;
+                virtual void ClearHandlers () = 0;
+                virtual void ClearQueue () = 0;
+                virtual size_t GetQueuedCount () const = 0;
+                virtual bool IsEmpty () const = 0;
+
+                FName EventName;
+                };
+
+            template<typename EventType>
+            struct CEEventChannel : CEEventChannelBase
+                {
+                std::vector<HandlerType<EventType>> Handlers;
+                std::vector<HandlerType<EventType>> PendingHandlers; //    
+                std::vector<EventType> Queue;
+                std::vector<EventType> DispatchBuffer; // ,  
+                uint32 BroadcastDepth = 0;
+                bool bClearPending = false;
+
+                //    Handlers  : push_back    
+                //    .     .
+                void AddHandler ( HandlerType<EventType> && Handler )
+                    {
+                    if (BroadcastDepth > 0)
+                        {
+                        PendingHandlers.push_back ( std::move ( Handler ) );
+                        }
+                    else
+                        {
+                        Handlers.push_back ( std::move ( Handler ) );
+                        }
+                    }
+
+                void Broadcast ( const EventType & Event )
+                    {
+                        // ,    ,    
+                    ++BroadcastDepth;
+                    const size_t count = Handlers.size ();
+                    for (size_t i = 0; i < count && !bClearPending; ++i)
+                        {
+                        Handlers[ i ] ( Event );
+                        }
+                    if (--BroadcastDepth == 0)
+                        {
+                        ApplyPendingHandlers ();
+                        }
+                    }
+
+                void ApplyPendingHandlers ()
+                    {
+                    if (bClearPending)
+                        {
+                        Handlers.clear ();
+                        bClearPending = false;
+                        }
+                    for (HandlerType<EventType> & handler : PendingHandlers)
+                        {
+                        Handlers.push_back ( std::move ( handler ) );
+                        }
+                    PendingHandlers.clear ();
+                    }
+
+                virtual void DispatchQueue () override
+                    {
+                        //   ,        
+                    DispatchBuffer.swap ( Queue );
+                    for (const EventType & event : DispatchBuffer)
+                        {
+                        Broadcast ( event );
+                        }
+                    DispatchBuffer.clear ();
+                    }
+
+                virtual void ClearHandlers () override
+                    {
+                    PendingHandlers.clear ();
+                    if (BroadcastDepth > 0)
+                        {
+                        bClearPending = true; //       
+                        }
+                    else
+                        {
+                        Handlers.clear ();
+                        }
+                    }
+
+                virtual void ClearQueue () override { Queue.clear (); } // DispatchBuffer   
+
+                virtual size_t GetQueuedCount () const override { return Queue.size (); }
+
+                virtual bool IsEmpty () const override
+                    {
+                    return Handlers.empty () && PendingHandlers.empty () && Queue.empty ();
+                    }
+                };
+
+            std::unordered_map<CEEventId, std::unique_ptr<CEEventChannelBase>> Channels;
+            std::vector<CEEventChannelBase *> ActiveChannels; //    ,    
+            std::vector<CEEventChannelBase *> DispatchingChannels;
+            CEConcurrentEventQueue ConcurrentQueue;
+            uint32 DispatchDepth = 0;              //  DispatchQueuedEvents/BroadcastEvent
+            bool bReleaseChannelsPending = false;  // Clear   
+
+            void EndDispatch ();
+
+            template<typename EventType>
+            static void DrainConcurrentEvent ( CEEventSystem * System, void * Payload )
+                {
+                EventType * event = static_cast< EventType * >( Payload );
+                if (System)
+                    {
+                    System->QueueEvent<EventType> ( std::move ( *event ) );
+                    }
+                event->~EventType ();
+                }
+
+            template<typename EventType>
+            CEEventChannel<EventType> * FindChannel ()
+                {
+                static_assert( std::is_base_of_v<CEEvent, EventType>, "EventType must inherit from CEEvent" );
+
+                auto it = Channels.find ( EventType::StaticEventId );
+                if (it == Channels.end ()) return nullptr;
+                return static_cast< CEEventChannel<EventType> * >( it->second.get () );
+                }
 
             template<typename EventType>
-            std::shared_ptr<CEDelegate<std::shared_ptr<EventType>>> GetOrCreateDelegate ( const std::string & EventName )
+            CEEventChannel<EventType> * GetOrCreateChannel ()
                 {
-                auto it = EventDelegates.find ( EventName );
-                if (it == EventDelegates.end ())
+                static_assert( std::is_base_of_v<CEEvent, EventType>, "EventType must inherit from CEEvent" );
+
+                auto & channel = Channels[ EventType::StaticEventId ];
+                if (!channel)
+                    {
+                    channel = std::make_unique<CEEventChannel<EventType>> ();
+                    channel->EventName = EventType::StaticEventName;
+                    }
+                else
                     {
-                    auto delegate = std::make_shared<CEDelegate<std::shared_ptr<EventType>>> ();
-                    delegate->SetName ( "Delegate_" + EventName );
-                    EventDelegates[ EventName ] = delegate;
-                    return delegate;
+                    CE_CORE_ASSERT ( channel->EventName == FName::FindExisting ( EventType::StaticEventName ),
+                                     "Event ID collision between two event types" );
                     }
-                return std::dynamic_pointer_cast< CEDelegate<std::shared_ptr<EventType>> >( it->second );
+                return static_cast< CEEventChannel<EventType> * >( channel.get () );
                 }
         };
-    }
\ No newline at end of file
+    }
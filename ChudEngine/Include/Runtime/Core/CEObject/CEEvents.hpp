@@ -8,28 +8,28 @@ namespace CE
         //   
     class CEActorDestroyedEvent : public CEEvent
         {
+        DECLARE_EVENT ( ActorDestroyedEvent )
+
         public:
             CEActor * DestroyedActor;
 
-            CEActorDestroyedEvent ( CEActor * Actor ) : DestroyedActor ( Actor )
-                {
-                SetName ( "ActorDestroyedEvent" );
-                }
+            CEActorDestroyedEvent ( CEActor * Actor ) : DestroyedActor ( Actor ) { }
         };
 
     class CEActorSpawnedEvent : public CEEvent
         {
+        DECLARE_EVENT ( ActorSpawnedEvent )
+
         public:
             CEActor * SpawnedActor;
 
-            CEActorSpawnedEvent ( CEActor * Actor ) : SpawnedActor ( Actor )
-                {
-                SetName ( "ActorSpawnedEvent" );
-                }
+            CEActorSpawnedEvent ( CEActor * Actor ) : SpawnedActor ( Actor ) { }
         };
 
     class CEHitEvent : public CEEvent
         {
+        DECLARE_EVENT ( HitEvent )
+
         public:
             CEActor * Instigator;
             CEActor * Target;
@@ -37,35 +37,30 @@ namespace CE
             float Damage;
 
             CEHitEvent ( CEActor * InstigatorActor, CEActor * TargetActor, const Math::Vector3 & Location, float DamageAmount )
-                : Instigator ( InstigatorActor ), Target ( TargetActor ), HitLocation ( Location ), Damage ( DamageAmount )
-                {
-                SetName ( "HitEvent" );
-                }
+                : Instigator ( InstigatorActor ), Target ( TargetActor ), HitLocation ( Location ), Damage ( DamageAmount ) { }
         };
 
     class CEBeginOverlapEvent : public CEEvent
         {
+        DECLARE_EVENT ( BeginOverlapEvent )
+
         public:
             CEActor * OverlappingActor;
             CEActor * OtherActor;
 
             CEBeginOverlapEvent ( CEActor * Actor1, CEActor * Actor2 )
-                : OverlappingActor ( Actor1 ), OtherActor ( Actor2 )
-                {
-                SetName ( "BeginOverlapEvent" );
-                }
+                : OverlappingActor ( Actor1 ), OtherActor ( Actor2 ) { }
         };
 
     class CEEndOverlapEvent : public CEEvent
         {
+        DECLARE_EVENT ( EndOverlapEvent )
+
         public:
             CEActor * OverlappingActor;
             CEActor * OtherActor;
 
             CEEndOverlapEvent ( CEActor * Actor1, CEActor * Actor2 )
-                : OverlappingActor ( Actor1 ), OtherActor ( Actor2 )
-                {
-                SetName ( "EndOverlapEvent" );
-                }
+                : OverlappingActor ( Actor1 ), OtherActor ( Actor2 ) { }
         };
     }
\ No newline at end of file
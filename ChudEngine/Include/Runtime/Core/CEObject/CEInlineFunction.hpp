@@ -0,0 +1,225 @@
+// Runtime/Core/CEObject/CEInlineFunction.hpp
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CE
+    {
+    template<typename Signature, size_t InlineSize = 32>
+    class CEInlineFunction;
+
+    // Non-allocating replacement for std::function used by ticks, delegates and events.
+    // The callable always lives in the inline buffer (too large a capture is a compile error),
+    // dispatch is one indirect call and nothing relies on RTTI.
+    // Free functions and object methods bypass the type-erased copy/destroy path entirely.
+    template<typename R, typename... Args, size_t InlineSize>
+    class CEInlineFunction<R ( Args... ), InlineSize>
+        {
+        public:
+            CEInlineFunction () = default;
+            CEInlineFunction ( std::nullptr_t ) { }
+
+            // Free function fast path
+            CEInlineFunction ( R ( *Function )( Args... ) )
+                {
+                if (Function)
+                    {
+                    new ( Storage ) FreeFunctionType ( Function );
+                    Invoker = &InvokeFreeFunction;
+                    }
+                }
+
+            // Lambdas and other functors
+            template<typename FunctorType,
+                typename DecayedType = std::decay_t<FunctorType>,
+                typename = std::enable_if_t<!std::is_same_v<DecayedType, CEInlineFunction>
+                                            && !std::is_pointer_v<DecayedType>
+                                            && std::is_invocable_r_v<R, DecayedType &, Args...>>>
+            CEInlineFunction ( FunctorType && Functor )
+                {
+                static_assert( sizeof ( DecayedType ) <= InlineSize,
+                               "Callable capture is too large for CEInlineFunction, capture less or raise InlineSize" );
+                static_assert( alignof( DecayedType ) <= alignof( std::max_align_t ),
+                               "Callable is over-aligned for CEInlineFunction" );
+                static_assert( std::is_copy_constructible_v<DecayedType>,
+                               "CEInlineFunction is copyable, so the callable must be copy-constructible" );
+
+                new ( Storage ) DecayedType ( std::forward<FunctorType> ( Functor ) );
+                Invoker = &InvokeFunctor<DecayedType>;
+                if constexpr (!std::is_trivially_copyable_v<DecayedType> || !std::is_trivially_destructible_v<DecayedType>)
+                    {
+                    Manager = &ManageFunctor<DecayedType>;
+                    }
+                }
+
+            // Object method fast path: stores the object and the member pointer, no wrapper lambda
+            template<typename ClassType>
+            static CEInlineFunction FromMethod ( ClassType * Object, R ( ClassType:: * Method )( Args... ) )
+                {
+                static_assert( sizeof ( MethodBinding<ClassType> ) <= InlineSize, "InlineSize too small for a method binding" );
+
+                CEInlineFunction result;
+                if (Object && Method)
+                    {
+                    new ( result.Storage ) MethodBinding<ClassType> { Object, Method };
+                    result.Invoker = &InvokeMethod<ClassType>;
+                    }
+                return result;
+                }
+
+            // Compile-time method: the call is direct, only the object pointer is stored
+            template<auto Method, typename ClassType>
+            static CEInlineFunction FromMethod ( ClassType * Object )
+                {
+                CEInlineFunction result;
+                if (Object)
+                    {
+                    new ( result.Storage ) ClassType * ( Object );
+                    result.Invoker = &InvokeStaticMethod<Method, ClassType>;
+                    }
+                return result;
+                }
+
+            CEInlineFunction ( const CEInlineFunction & Other ) { CopyFrom ( Other ); }
+
+            CEInlineFunction ( CEInlineFunction && Other ) noexcept { MoveFrom ( Other ); }
+
+            CEInlineFunction & operator=( const CEInlineFunction & Other )
+                {
+                if (this != &Other)
+                    {
+                    Reset ();
+                    CopyFrom ( Other );
+                    }
+                return *this;
+                }
+
+            CEInlineFunction & operator=( CEInlineFunction && Other ) noexcept
+                {
+                if (this != &Other)
+                    {
+                    Reset ();
+                    MoveFrom ( Other );
+                    }
+                return *this;
+                }
+
+            CEInlineFunction & operator=( std::nullptr_t )
+                {
+                Reset ();
+                return *this;
+                }
+
+            ~CEInlineFunction () { Reset (); }
+
+            R operator()( Args... Arguments ) const
+                {
+                return Invoker ( const_cast< unsigned char * >( Storage ), std::forward<Args> ( Arguments )... );
+                }
+
+            explicit operator bool () const { return Invoker != nullptr; }
+
+            void Reset ()
+                {
+                if (Manager)
+                    {
+                    Manager ( EManageOperation::Destroy, Storage, nullptr );
+                    }
+                Invoker = nullptr;
+                Manager = nullptr;
+                }
+
+        private:
+            using InvokerType = R ( * )( void * Storage, Args &&... Arguments );
+            using FreeFunctionType = R ( * )( Args... );
+
+            enum class EManageOperation { Copy, Move, Destroy };
+            using ManagerType = void ( * )( EManageOperation Operation, void * Destination, void * Source );
+
+            template<typename ClassType>
+            struct MethodBinding
+                {
+                ClassType * Object;
+                R ( ClassType:: * Method )( Args... );
+                };
+
+            static R InvokeFreeFunction ( void * Storage, Args &&... Arguments )
+                {
+                return ( *static_cast< FreeFunctionType * >( Storage ) )( std::forward<Args> ( Arguments )... );
+                }
+
+            template<typename FunctorType>
+            static R InvokeFunctor ( void * Storage, Args &&... Arguments )
+                {
+                return ( *static_cast< FunctorType * >( Storage ) )( std::forward<Args> ( Arguments )... );
+                }
+
+            template<typename ClassType>
+            static R InvokeMethod ( void * Storage, Args &&... Arguments )
+                {
+                auto & binding = *static_cast< MethodBinding<ClassType> * >( Storage );
+                return ( binding.Object->*binding.Method )( std::forward<Args> ( Arguments )... );
+                }
+
+            template<auto Method, typename ClassType>
+            static R InvokeStaticMethod ( void * Storage, Args &&... Arguments )
+                {
+                return ( ( *static_cast< ClassType ** >( Storage ) )->*Method )( std::forward<Args> ( Arguments )... );
+                }
+
+            template<typename FunctorType>
+            static void ManageFunctor ( EManageOperation Operation, void * Destination, void * Source )
+                {
+                switch (Operation)
+                    {
+                        case EManageOperation::Copy:
+                            new ( Destination ) FunctorType ( *static_cast< const FunctorType * >( Source ) );
+                            break;
+                        case EManageOperation::Move:
+                            new ( Destination ) FunctorType ( std::move ( *static_cast< FunctorType * >( Source ) ) );
+                            static_cast< FunctorType * >( Source )->~FunctorType ();
+                            break;
+                        case EManageOperation::Destroy:
+                            static_cast< FunctorType * >( Destination )->~FunctorType ();
+                            break;
+                    }
+                }
+
+            void CopyFrom ( const CEInlineFunction & Other )
+                {
+                if (Other.Manager)
+                    {
+                    Other.Manager ( EManageOperation::Copy, Storage, const_cast< unsigned char * >( Other.Storage ) );
+                    }
+                else
+                    {
+                    std::memcpy ( Storage, Other.Storage, InlineSize );
+                    }
+                Invoker = Other.Invoker;
+                Manager = Other.Manager;
+                }
+
+            void MoveFrom ( CEInlineFunction & Other )
+                {
+                if (Other.Manager)
+                    {
+                    Other.Manager ( EManageOperation::Move, Storage, Other.Storage );
+                    }
+                else
+                    {
+                    std::memcpy ( Storage, Other.Storage, InlineSize );
+                    }
+                Invoker = Other.Invoker;
+                Manager = Other.Manager;
+                Other.Invoker = nullptr;
+                Other.Manager = nullptr;
+                }
+
+            alignas( std::max_align_t ) unsigned char Storage[ InlineSize ] = {};
+            InvokerType Invoker = nullptr;
+            ManagerType Manager = nullptr;
+        };
+    }
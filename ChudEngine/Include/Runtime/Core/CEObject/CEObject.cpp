@@ -1,83 +1,170 @@
 #include "Core/CEObject/CEObject.hpp"
+#include "Core/CEObject/CEClass.hpp"
 #include <algorithm>
 
 namespace CE
     {
     //   
-    std::unordered_map<uint64, CEObject *> CEObject::AllObjects;
-    std::mutex CEObject::IDMutex;
+    CEObject::CEObjectRegistryShard CEObject::RegistryShards[ CEObject::REGISTRY_SHARD_COUNT ];
+    CEObject::CEObjectNameShard CEObject::NameShards[ CEObject::REGISTRY_SHARD_COUNT ];
 
-    std::random_device CEObject::RandomDevice;
-    std::mt19937_64 CEObject::RandomGenerator ( CEObject::RandomDevice () );
-    std::uniform_int_distribution<uint64> CEObject::RandomDistribution ( 1, UINT64_MAX - 1 );
+    namespace
+        {
+        std::atomic<uint64> NextIDBlock { 1 };
+
+        //   ID  : [NextID, EndID)
+        thread_local uint64 NextID = 0;
+        thread_local uint64 EndID = 0;
+        }
 
     uint64 CEObject::GenerateID ()
         {
-        std::lock_guard<std::mutex> lock ( IDMutex );
+        if (NextID == EndID)
+            {
+            NextID = NextIDBlock.fetch_add ( ID_BLOCK_SIZE, std::memory_order_relaxed );
+            EndID = NextID + ID_BLOCK_SIZE;
+            }
+        return NextID++;
+        }
+
+    void CEObject::ReserveIDs ( uint64 Count )
+        {
+        if (EndID - NextID >= Count) return;
 
-        uint64 newID;
-        int attempts = 0;
-        const int MAX_ATTEMPTS = 1000;
+            //    : ID     
+        uint64 blockSize = std::max ( Count, ID_BLOCK_SIZE );
+        NextID = NextIDBlock.fetch_add ( blockSize, std::memory_order_relaxed );
+        EndID = NextID + blockSize;
+        }
+
+    CEObject::CEObjectRegistryShard & CEObject::GetRegistryShard ( uint64 ID )
+        {
+            //  ID      
+        return RegistryShards[ ( ID * 0x9E3779B97F4A7C15ull ) >> 58 ];
+        }
+
+    CEObject::CEObjectNameShard & CEObject::GetNameShard ( FName ObjectName )
+        {
+        return NameShards[ ObjectName.GetIndex () % REGISTRY_SHARD_COUNT ];
+        }
 
-        do
+    void CEObject::RegisterObject ( CEObject * Object )
+        {
             {
-            newID = RandomDistribution ( RandomGenerator );
-            attempts++;
+            CEObjectRegistryShard & shard = GetRegistryShard ( Object->UniqueID );
+            std::lock_guard<std::mutex> lock ( shard.Mutex );
+            shard.Objects[ Object->UniqueID ] = Object;
+            }
+        AddNameIndex ( Object );
+        }
+
+    void CEObject::UnregisterObject ( CEObject * Object )
+        {
+        RemoveNameIndex ( Object );
+
+        CEObjectRegistryShard & shard = GetRegistryShard ( Object->UniqueID );
+        std::lock_guard<std::mutex> lock ( shard.Mutex );
+        shard.Objects.erase ( Object->UniqueID );
+        }
 
-            if (attempts >= MAX_ATTEMPTS)
-                {
-                CE_CORE_CRITICAL ( "Failed to generate unique ID after {} attempts", MAX_ATTEMPTS );
-                throw std::runtime_error ( "CEObject ID generation failed" );
-                }
+    void CEObject::DetachFromRegistries ( CEObject * Object )
+        {
+            //   ,   
+        UnregisterObject ( Object );
+        CEClass::RemoveInstance ( Object );
+        }
 
-            } while (AllObjects.find ( newID ) != AllObjects.end ());
+    void CEObject::AttachToRegistries ( CEObject * Object )
+        {
+            //   ,   :  ,   
+        RegisterObject ( Object );
+        CEClass::LinkInstance ( Object );
+        }
 
-        CE_DEBUG ( "Generated new object ID: {}", newID );
-        return newID;
+    void CEObject::AddNameIndex ( CEObject * Object )
+        {
+        CEObjectNameShard & shard = GetNameShard ( Object->Name );
+        std::lock_guard<std::mutex> lock ( shard.Mutex );
+
+        std::vector<CEObject *> & objects = shard.Objects[ Object->Name ];
+        Object->NameIndexSlot = static_cast< uint32 >( objects.size () );
+        objects.push_back ( Object );
+        }
+
+    void CEObject::RemoveNameIndex ( CEObject * Object )
+        {
+        CEObjectNameShard & shard = GetNameShard ( Object->Name );
+        std::lock_guard<std::mutex> lock ( shard.Mutex );
+
+        if (Object->NameIndexSlot == UINT32_MAX) return;
+
+        auto it = shard.Objects.find ( Object->Name );
+        if (it == shard.Objects.end ()) return;
+
+        // swap-and-pop   
+        std::vector<CEObject *> & objects = it->second;
+        CEObject * last = objects.back ();
+        objects[ Object->NameIndexSlot ] = last;
+        last->NameIndexSlot = Object->NameIndexSlot;
+        objects.pop_back ();
+        Object->NameIndexSlot = UINT32_MAX;
+        if (objects.empty ())
+            {
+            shard.Objects.erase ( it );
+            }
+        }
+
+    void CEObject::SetName ( const FName & NewName )
+        {
+        if (Name == NewName) return;
+
+            //    (  )        
+        bool bIndexed = NameIndexSlot != UINT32_MAX;
+        RemoveNameIndex ( this );
+        Name = NewName;
+        if (bIndexed)
+            {
+            AddNameIndex ( this );
+            }
         }
 
     CEObject::CEObject ()
         : Name ( "CEObject" ), UniqueID ( GenerateID () ), bPendingKill ( false ), bInitialized ( false )
         {
-        std::lock_guard<std::mutex> lock ( IDMutex );
-        AllObjects[ UniqueID ] = this;
+        RegisterObject ( this );
+        SetObjectClass ( this, StaticClass () );
 
-        std::string safeName = Name;
-        CE_DEBUG ( "CEObject '{}' created (ID: {})", safeName, UniqueID );
+        CE_DEBUG ( "CEObject '{}' created (ID: {})", Name, UniqueID );
         }
 
-    CEObject::CEObject ( const std::string & ObjectName )
+    CEObject::CEObject ( const FName & ObjectName )
         : Name ( ObjectName ), UniqueID ( GenerateID () ), bPendingKill ( false ), bInitialized ( false )
         {
-        std::lock_guard<std::mutex> lock ( IDMutex );
-        AllObjects[ UniqueID ] = this;
+        RegisterObject ( this );
+        SetObjectClass ( this, StaticClass () );
 
-        std::string safeName = Name;
-        CE_DEBUG ( "CEObject '{}' created (ID: {})", safeName, UniqueID );
+        CE_DEBUG ( "CEObject '{}' created (ID: {})", Name, UniqueID );
         }
 
-    CEObject::~CEObject ()
+    CEObject::CEObject ( const FName & ObjectName, CEClassObjectTag )
+        : Name ( ObjectName ), UniqueID ( GenerateID () ), bPendingKill ( false ), bInitialized ( false )
         {
-        std::string safeName = Name;
-        uint64 safeID = UniqueID;
+        RegisterObject ( this );
+        }
 
+    CEObject::~CEObject ()
         {
-        std::lock_guard<std::mutex> lock ( IDMutex );
-        auto it = AllObjects.find ( safeID );
-        if (it != AllObjects.end ())
-            {
-            AllObjects.erase ( it );
-            }
-        }
+            //   :         
+        UnregisterObject ( this );
+        CEClass::RemoveInstance ( this );
 
-        CE_DEBUG ( "CEObject '{}' destroyed (ID: {})", safeName, safeID );
+        CE_DEBUG ( "CEObject '{}' destroyed (ID: {})", Name, UniqueID );
         }
 
     void CEObject::BeginPlay ()
         {
         bInitialized = true;
-        std::string safeName = Name;
-        CE_DEBUG ( "CEObject BeginPlay: {}", safeName );
+        CE_DEBUG ( "CEObject BeginPlay: {}", Name );
         }
 
     void CEObject::Tick ( float DeltaTime )
@@ -88,40 +175,64 @@ namespace CE
     void CEObject::Destroy ()
         {
         bPendingKill = true;
-        std::string safeName = Name;
-        CE_DEBUG ( "CEObject marked for destruction: {}", safeName );
+        CE_DEBUG ( "CEObject marked for destruction: {}", Name );
         }
 
     CEObject * CEObject::FindObjectByName ( const std::string & Name )
         {
-        std::lock_guard<std::mutex> lock ( IDMutex );
+            // ,     FName,       
+        FName existingName = FName::FindExisting ( Name );
+        if (existingName.IsNone () && !Name.empty ()) return nullptr;
+        return FindObjectByFName ( existingName );
+        }
 
-        for (auto & pair : AllObjects)
+    CEObject * CEObject::FindObjectByFName ( FName Name )
+        {
+        CEObjectNameShard & shard = GetNameShard ( Name );
+        std::lock_guard<std::mutex> lock ( shard.Mutex );
+
+        auto it = shard.Objects.find ( Name );
+        if (it != shard.Objects.end ())
             {
-            if (pair.second && pair.second->Name == Name)
-                {
-                return pair.second;
-                }
+            return it->second.front ();
             }
         return nullptr;
         }
 
     CEObject * CEObject::FindObjectByID ( uint64 ID )
         {
-        std::lock_guard<std::mutex> lock ( IDMutex );
+        CEObjectRegistryShard & shard = GetRegistryShard ( ID );
+        std::lock_guard<std::mutex> lock ( shard.Mutex );
 
-        auto it = AllObjects.find ( ID );
-        if (it != AllObjects.end ())
+        auto it = shard.Objects.find ( ID );
+        if (it != shard.Objects.end ())
             {
             return it->second;
             }
         return nullptr;
         }
 
+    CEClass * CEObject::StaticClass ()
+        {
+        static CEClass * Class = new CEClass ( "CEObject" );
+        return Class;
+        }
+
+    void CEObject::SetObjectClass ( CEObject * Object, CEClass * Class )
+        {
+            //   DECLARE_CLASS  ;   ,
+            //    -  
+        Object->ObjectClass.store ( Class );
+        CEClass::LinkInstance ( Object );
+        }
+
     std::vector<CEObject *> CEObject::FindObjectsOfType ( CEClass * Class )
         {
         std::vector<CEObject *> Result;
-        // TODO:     
+        if (Class)
+            {
+            CEClass::CollectInstances ( Class, Result );
+            }
         return Result;
         }
     }
\ No newline at end of file
@@ -1,31 +1,54 @@
 #pragma once
 #include "Utils/Logger.hpp"
 #include "Core/CoreTypes.hpp"
+#include "Core/Name/CEName.hpp"
+#include "Core/Memory/CEObjectAllocator.hpp"
 #include <unordered_map>
 #include <vector>
 #include <string>
-#include <random>
 #include <mutex>
+#include <atomic>
+#include <new>
 
 namespace CE
     {
     class CEClass;
 
+    // true,  T    DECLARE_CLASS (    StaticClass  )
+    template<typename T, typename = void>
+    struct CEIsDeclaredClass : std::false_type { };
+
+    template<typename T>
+    struct CEIsDeclaredClass<T, std::void_t<typename T::ThisClass>> : std::is_same<typename T::ThisClass, T> { };
+
     class CEObject
         {
         public:
+            using ThisClass = CEObject;
+
             CEObject ();
-            explicit CEObject ( const std::string & ObjectName ); //    
+            explicit CEObject ( const FName & ObjectName ); //    
             virtual ~CEObject ();
 
+            //     CEObjectAllocator   : new -   
+            //      .     delete   .
+            static void * operator new ( size_t Size ) { return CEObjectAllocator::Allocate ( Size ); }
+            static void operator delete ( void * Block, size_t Size ) { CEObjectAllocator::Free ( Block, Size ); }
+            static void * operator new ( size_t Size, std::align_val_t Alignment ) { return ::operator new( Size, Alignment ); }
+            static void operator delete ( void * Block, std::align_val_t Alignment ) { ::operator delete( Block, Alignment ); }
+            static void * operator new ( size_t, void * Place ) noexcept { return Place; }
+            static void operator delete ( void *, void * ) noexcept { }
+
             //  
             virtual void BeginPlay ();
             virtual void Tick ( float DeltaTime );
             virtual void Destroy ();
 
             //  
-            const std::string & GetName () const { return Name; }
-            void SetName ( const std::string & NewName ) { Name = NewName; }
+            //      FName   ,    
+            const std::string & GetName () const { return Name.ToString (); }
+            FName GetFName () const { return Name; }
+            void SetName ( const FName & NewName );
 
             //  
             uint64 GetUniqueID () const { return UniqueID; }
@@ -34,43 +57,102 @@ namespace CE
             bool IsPendingKill () const { return bPendingKill; }
             bool IsInitialized () const { return bInitialized; }
 
-            //   
-            virtual CEClass * GetClass () const { return nullptr; }
+            //  :   ,   DECLARE_CLASS
+            static CEClass * StaticClass ();
+            CEClass * GetClass () const { return ObjectClass.load ( std::memory_order_relaxed ); }
 
+            //    RTTI (  CEClass.hpp)
+            inline bool IsA ( const CEClass * Class ) const;
 
 
-            //  
+
+            //  :    DECLARE_CLASS -   CEClass,  dynamic_cast
             template<typename T>
             T * CastTo ()
                 {
-                return dynamic_cast< T * >( this );
+                if constexpr (CEIsDeclaredClass<T>::value)
+                    {
+                    return IsA ( T::StaticClass () ) ? static_cast< T * >( this ) : nullptr;
+                    }
+                else
+                    {
+                    return dynamic_cast< T * >( this );
+                    }
                 }
 
             template<typename T>
             const T * CastTo () const
                 {
-                return dynamic_cast< const T * >( this );
+                return const_cast< CEObject * >( this )->CastTo<T> ();
                 }
 
             //  
+            // FindObjectsOfType          
+            // FindObjectByName     ;       .
+            // ,    ,         
             static CEObject * FindObjectByName ( const std::string & Name );
+            static CEObject * FindObjectByFName ( FName Name );
             static CEObject * FindObjectByID ( uint64 ID );
             static std::vector<CEObject *> FindObjectsOfType ( CEClass * Class );
             static uint64 GenerateID ();
 
+            // ,   Count  GenerateID     ID   
+            static void ReserveIDs ( uint64 Count );
+
+            // ID    ID_BLOCK_SIZE  :    thread_local 
+            static constexpr uint64 ID_BLOCK_SIZE = 1024;
+            static constexpr uint32 REGISTRY_SHARD_COUNT = 64;
+
         protected:
-            std::string Name;
+            FName Name;
             uint64 UniqueID;
             bool bPendingKill;
             bool bInitialized;
 
         private:
-            static std::unordered_map<uint64, CEObject *> AllObjects;
-            static std::mutex IDMutex;
+            friend class CEClass;
+            friend class CEClassRegistrar;
+            friend class CEWorld; //       
+
+            //    CEClass:      
+            struct CEClassObjectTag { };
+            CEObject ( const FName & ObjectName, CEClassObjectTag );
+
+            static void SetObjectClass ( CEObject * Object, CEClass * Class );
+
+            uint32 NameIndexSlot = UINT32_MAX; // UINT32_MAX -     
+            uint32 ObjectClassSlot = 0;
+            std::atomic<CEClass *> ObjectClass { nullptr };
+            CEClass * InstanceListClass = nullptr; //      (. CEClass::LinkInstance)
+
+            //   ,      :
+            // ,   ,      
+            struct alignas( 64 ) CEObjectRegistryShard
+                {
+                std::mutex Mutex;
+                std::unordered_map<uint64, CEObject *> Objects;
+                };
+
+            //  :     ,  SetName  .
+            //        , NameIndexSlot -   
+            struct alignas( 64 ) CEObjectNameShard
+                {
+                std::mutex Mutex;
+                std::unordered_map<FName, std::vector<CEObject *>> Objects;
+                };
+
+            static CEObjectRegistryShard RegistryShards[ REGISTRY_SHARD_COUNT ];
+            static CEObjectNameShard NameShards[ REGISTRY_SHARD_COUNT ];
+
+            static CEObjectRegistryShard & GetRegistryShard ( uint64 ID );
+            static CEObjectNameShard & GetNameShard ( FName ObjectName );
+            static void RegisterObject ( CEObject * Object );
+            static void UnregisterObject ( CEObject * Object );
+            static void AddNameIndex ( CEObject * Object );
+            static void RemoveNameIndex ( CEObject * Object );
 
-            //    ()
-            static std::random_device RandomDevice;
-            static std::mt19937_64 RandomGenerator;
-            static std::uniform_int_distribution<uint64> RandomDistribution;
+            // ,      ;     (  )
+            static void DetachFromRegistries ( CEObject * Object );
+            static void AttachToRegistries ( CEObject * Object );
         };
     }
\ No newline at end of file
@@ -1,11 +1,16 @@
 #include "Core/CEObject/CETickManager.hpp"
+#include "Core/Jobs/CEJobSystem.hpp"
 #include "Utils/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
 
 namespace CE
     {
-    CETickFunction::CETickFunction ( std::function<void ( float )> InFunction, CETickGroup InGroup, float InInterval )
-        : TickFunction ( InFunction ), TickGroup ( InGroup ), TickInterval ( InInterval ),
-        AccumulatedTime ( 0.0f ), bEnabled ( true )
+    CETickFunction::CETickFunction ( CETickDelegate InFunction, CETickGroup InGroup, float InInterval,
+                                     bool bInThreadSafe )
+        : TickFunction ( std::move ( InFunction ) ), TickGroup ( InGroup ), TickInterval ( InInterval ),
+        AccumulatedTime ( 0.0f ), bEnabled ( true ), bThreadSafe ( bInThreadSafe )
         {
         }
 
@@ -26,7 +31,13 @@ namespace CE
             AccumulatedTime += DeltaTime;
             if (AccumulatedTime >= TickInterval)
                 {
-                AccumulatedTime = 0.0f;
+                //  ,    -  ,  , .
+                //       .
+                AccumulatedTime -= TickInterval;
+                if (AccumulatedTime >= TickInterval)
+                    {
+                    AccumulatedTime = std::fmod ( AccumulatedTime, TickInterval );
+                    }
                 return true;
                 }
             return false;
@@ -54,31 +65,528 @@ namespace CE
         CE_DEBUG ( "CETickManager destroyed" );
         }
 
-    void CETickManager::RegisterTickFunction ( CEObject * Owner, std::function<void ( float )> Function,
-                                               CETickGroup Group, float Interval )
+    CETickFunctionHandle CETickManager::RegisterTickFunction ( CEObject * Owner, CETickDelegate Function,
+                                                               CETickGroup Group, float Interval, bool bThreadSafe )
         {
-        if (!Owner || !Function) return;
+        if (!Owner || !Function) return {};
+        if (static_cast< int >( Group ) < 0 || Group >= CETickGroup::MAX) return {};
+
+        uint32 slotIndex;
+        if (!FreeSlots.empty ())
+            {
+            slotIndex = FreeSlots.back ();
+            FreeSlots.pop_back ();
+            }
+        else
+            {
+            slotIndex = static_cast< uint32 >( Slots.size () );
+            Slots.emplace_back ();
+            }
+
+        CETickSlot & slot = Slots[ slotIndex ];
+        slot.bAlive = true;
+        slot.Group = Group;
+        slot.bThreadSafe = bThreadSafe;
+        slot.DenseIndex = PENDING_INDEX;
+
+        CETickFunction tickFunc ( std::move ( Function ), Group, Interval, bThreadSafe );
+        tickFunc.Owner = Owner;
+        tickFunc.SlotIndex = slotIndex;
+        if (Interval > 0.0f)
+            {
+            AssignTickPhase ( tickFunc );
+            }
+
+        //       
+        if (bIsTicking)
+            {
+            PendingAdds.push_back ( std::move ( tickFunc ) );
+            }
+        else
+            {
+            AddToGroup ( std::move ( tickFunc ) );
+            }
 
-        CETickFunction tickFunc ( Function, Group, Interval );
-        OwnerTickFunctions[ Owner ].push_back ( tickFunc );
+        CETickFunctionHandle handle { slotIndex, slot.Generation };
+        OwnerHandles[ Owner ].push_back ( handle );
+
+        //        
+        if (!OwnerPrerequisites.empty ())
+            {
+            GroupTickGraphs[ static_cast< int >( Group ) ].bDirty = true;
+            }
 
         std::string safeName = Owner->GetName ();
-        CE_DEBUG ( "Registered tick function for '{}' in group {}", safeName, static_cast< int >( Group ) );
+        CE_DEBUG ( "Registered {}tick function for '{}' in group {}",
+                   bThreadSafe ? "thread-safe " : "", safeName, static_cast< int >( Group ) );
+        return handle;
+        }
+
+    void CETickManager::UnregisterTickFunction ( CETickFunctionHandle Handle )
+        {
+        CETickFunction * tickFunc = GetTickFunction ( Handle );
+        if (!tickFunc) return;
+
+        auto it = OwnerHandles.find ( tickFunc->GetOwner () );
+        if (it != OwnerHandles.end ())
+            {
+            auto & handles = it->second;
+            handles.erase ( std::remove ( handles.begin (), handles.end (), Handle ), handles.end () );
+            if (handles.empty ())
+                {
+                OwnerHandles.erase ( it );
+                }
+            }
+
+        UnregisterSlot ( Handle.Index );
         }
 
     void CETickManager::UnregisterTickFunctions ( CEObject * Owner )
         {
         if (!Owner) return;
 
-        auto it = OwnerTickFunctions.find ( Owner );
-        if (it != OwnerTickFunctions.end ())
+        auto it = OwnerHandles.find ( Owner );
+        if (it != OwnerHandles.end ())
             {
-            OwnerTickFunctions.erase ( it );
+            for (const CETickFunctionHandle & handle : it->second)
+                {
+                if (IsHandleAlive ( handle ))
+                    {
+                    UnregisterSlot ( handle.Index );
+                    }
+                }
+            OwnerHandles.erase ( it );
+
+            size_t ownerPrerequisiteCount = OwnerPrerequisites.size ();
+            OwnerPrerequisites.erase ( std::remove_if ( OwnerPrerequisites.begin (), OwnerPrerequisites.end (),
+                                                        [ Owner ] ( const CEOwnerTickPrerequisite & Entry )
+                                                        {
+                                                        return Entry.Owner == Owner || Entry.PrerequisiteOwner == Owner;
+                                                        } ),
+                                       OwnerPrerequisites.end () );
+            if (OwnerPrerequisites.size () != ownerPrerequisiteCount)
+                {
+                MarkTickGraphsDirty ();
+                }
+
             std::string safeName = Owner->GetName ();
             CE_DEBUG ( "Unregistered all tick functions for '{}'", safeName );
             }
         }
 
+    CETickFunction * CETickManager::GetTickFunction ( CETickFunctionHandle Handle )
+        {
+        if (!IsHandleAlive ( Handle )) return nullptr;
+        return FindSlotFunction ( Handle.Index );
+        }
+
+    CETickFunction * CETickManager::FindSlotFunction ( uint32 SlotIndex )
+        {
+        const CETickSlot & slot = Slots[ SlotIndex ];
+        if (slot.DenseIndex != PENDING_INDEX)
+            {
+            return &GetBucket ( slot.Group, slot.bThreadSafe )[ slot.DenseIndex ];
+            }
+
+        for (CETickFunction & pending : PendingAdds)
+            {
+            if (pending.SlotIndex == SlotIndex)
+                {
+                return &pending;
+                }
+            }
+        return nullptr;
+        }
+
+    void CETickManager::AssignTickPhase ( CETickFunction & Function )
+        {
+        uint16 laneIndex = 0;
+        while (laneIndex < IntervalLanes.size () && std::fabs ( IntervalLanes[ laneIndex ].Interval - Function.TickInterval ) > 1e-4f)
+            {
+            ++laneIndex;
+            }
+        if (laneIndex == IntervalLanes.size ())
+            {
+            if (IntervalLanes.size () >= UINT16_MAX) return;
+            IntervalLanes.emplace_back ();
+            IntervalLanes.back ().Interval = Function.TickInterval;
+            }
+
+        CETickIntervalLane & lane = IntervalLanes[ laneIndex ];
+        uint8 bestBin = 0;
+        for (uint8 bin = 1; bin < PHASE_BINS; ++bin)
+            {
+            if (lane.BinLoad[ bin ] < lane.BinLoad[ bestBin ])
+                {
+                bestBin = bin;
+                }
+            }
+
+        lane.BinLoad[ bestBin ] += Function.TickCost;
+        Function.PhaseLane = laneIndex;
+        Function.PhaseBin = bestBin;
+
+        //    N    (N + 0.5) / PHASE_BINS 
+        Function.AccumulatedTime = Function.TickInterval * ( 1.0f - ( bestBin + 0.5f ) / PHASE_BINS );
+        }
+
+    void CETickManager::ReleaseTickPhase ( CETickFunction & Function )
+        {
+        if (Function.PhaseLane >= IntervalLanes.size ()) return;
+
+        float & load = IntervalLanes[ Function.PhaseLane ].BinLoad[ Function.PhaseBin ];
+        load = std::max ( load - Function.TickCost, 0.0f );
+        Function.PhaseLane = UINT16_MAX;
+        }
+
+    void CETickManager::SetTickCost ( CETickFunctionHandle Handle, float Cost )
+        {
+        CETickFunction * tickFunc = GetTickFunction ( Handle );
+        if (!tickFunc) return;
+
+        Cost = std::max ( Cost, 0.0f );
+        if (tickFunc->PhaseLane < IntervalLanes.size ())
+            {
+            float & load = IntervalLanes[ tickFunc->PhaseLane ].BinLoad[ tickFunc->PhaseBin ];
+            load = std::max ( load - tickFunc->TickCost + Cost, 0.0f );
+            }
+        tickFunc->TickCost = Cost;
+        }
+
+    void CETickManager::AddTickPrerequisite ( CETickFunctionHandle Function, CETickFunctionHandle Prerequisite )
+        {
+        if (!IsHandleAlive ( Function ) || !IsHandleAlive ( Prerequisite ) || Function == Prerequisite) return;
+
+        CETickGroup group = Slots[ Function.Index ].Group;
+        CETickGroup prerequisiteGroup = Slots[ Prerequisite.Index ].Group;
+        if (prerequisiteGroup > group)
+            {
+            CE_WARN ( "Tick prerequisite ignored: prerequisite group {} runs after group {}",
+                      static_cast< int >( prerequisiteGroup ), static_cast< int >( group ) );
+            return;
+            }
+        if (prerequisiteGroup < group) return; //     
+
+        for (const CETickPrerequisite & entry : Prerequisites)
+            {
+            if (entry.Function == Function && entry.Prerequisite == Prerequisite) return;
+            }
+
+        Prerequisites.push_back ( { Function, Prerequisite } );
+        GroupTickGraphs[ static_cast< int >( group ) ].bDirty = true;
+        }
+
+    void CETickManager::RemoveTickPrerequisite ( CETickFunctionHandle Function, CETickFunctionHandle Prerequisite )
+        {
+        for (size_t i = 0; i < Prerequisites.size (); ++i)
+            {
+            if (Prerequisites[ i ].Function == Function && Prerequisites[ i ].Prerequisite == Prerequisite)
+                {
+                Prerequisites.erase ( Prerequisites.begin () + i );
+                if (IsHandleAlive ( Function ))
+                    {
+                    GroupTickGraphs[ static_cast< int >( Slots[ Function.Index ].Group ) ].bDirty = true;
+                    }
+                return;
+                }
+            }
+        }
+
+    void CETickManager::AddTickPrerequisite ( CEObject * Owner, CEObject * PrerequisiteOwner )
+        {
+        if (!Owner || !PrerequisiteOwner || Owner == PrerequisiteOwner) return;
+
+        for (const CEOwnerTickPrerequisite & entry : OwnerPrerequisites)
+            {
+            if (entry.Owner == Owner && entry.PrerequisiteOwner == PrerequisiteOwner) return;
+            }
+
+        OwnerPrerequisites.push_back ( { Owner, PrerequisiteOwner } );
+        MarkTickGraphsDirty ();
+
+        std::string safeName = Owner->GetName ();
+        std::string safePrerequisiteName = PrerequisiteOwner->GetName ();
+        CE_DEBUG ( "Tick prerequisite: '{}' ticks after '{}'", safeName, safePrerequisiteName );
+        }
+
+    void CETickManager::RemoveTickPrerequisite ( CEObject * Owner, CEObject * PrerequisiteOwner )
+        {
+        for (size_t i = 0; i < OwnerPrerequisites.size (); ++i)
+            {
+            if (OwnerPrerequisites[ i ].Owner == Owner && OwnerPrerequisites[ i ].PrerequisiteOwner == PrerequisiteOwner)
+                {
+                OwnerPrerequisites.erase ( OwnerPrerequisites.begin () + i );
+                MarkTickGraphsDirty ();
+                return;
+                }
+            }
+        }
+
+    size_t CETickManager::GetTickFunctionCount ( CETickGroup Group ) const
+        {
+        int groupIndex = static_cast< int >( Group );
+        if (groupIndex < 0 || groupIndex >= static_cast< int > ( CETickGroup::MAX )) return 0;
+        return GroupTickFunctions[ groupIndex ].GameThread.size () + GroupTickFunctions[ groupIndex ].Parallel.size ();
+        }
+
+    std::vector<CETickFunction> & CETickManager::GetBucket ( CETickGroup Group, bool bThreadSafe )
+        {
+        CETickGroupBucket & bucket = GroupTickFunctions[ static_cast< int >( Group ) ];
+        return bThreadSafe ? bucket.Parallel : bucket.GameThread;
+        }
+
+    bool CETickManager::IsHandleAlive ( CETickFunctionHandle Handle ) const
+        {
+        return Handle.Index < Slots.size ()
+            && Slots[ Handle.Index ].bAlive
+            && Slots[ Handle.Index ].Generation == Handle.Generation;
+        }
+
+    void CETickManager::AddToGroup ( CETickFunction && Function )
+        {
+        auto & functions = GetBucket ( Function.TickGroup, Function.bThreadSafe );
+        Slots[ Function.SlotIndex ].DenseIndex = static_cast< uint32 >( functions.size () );
+        functions.push_back ( std::move ( Function ) );
+        }
+
+    void CETickManager::RemoveFromGroup ( uint32 SlotIndex )
+        {
+        CETickSlot & slot = Slots[ SlotIndex ];
+        auto & functions = GetBucket ( slot.Group, slot.bThreadSafe );
+        uint32 denseIndex = slot.DenseIndex;
+        uint32 lastIndex = static_cast< uint32 >( functions.size () - 1 );
+
+        // swap-and-pop:      
+        if (denseIndex != lastIndex)
+            {
+            functions[ denseIndex ] = std::move ( functions[ lastIndex ] );
+            Slots[ functions[ denseIndex ].SlotIndex ].DenseIndex = denseIndex;
+            }
+        functions.pop_back ();
+        slot.DenseIndex = PENDING_INDEX;
+        }
+
+    void CETickManager::UnregisterSlot ( uint32 SlotIndex )
+        {
+        CETickSlot & slot = Slots[ SlotIndex ];
+
+        if (CETickFunction * tickFunc = FindSlotFunction ( SlotIndex ))
+            {
+            ReleaseTickPhase ( *tickFunc );
+            }
+
+        if (slot.DenseIndex != PENDING_INDEX && GetBucket ( slot.Group, slot.bThreadSafe )[ slot.DenseIndex ].bInTickGraph)
+            {
+            GroupTickGraphs[ static_cast< int >( slot.Group ) ].bDirty = true;
+            }
+
+        if (slot.DenseIndex == PENDING_INDEX)
+            {
+            //       
+            PendingAdds.erase ( std::remove_if ( PendingAdds.begin (), PendingAdds.end (),
+                                                 [ SlotIndex ] ( const CETickFunction & Func ) { return Func.SlotIndex == SlotIndex; } ),
+                                PendingAdds.end () );
+            ReleaseSlot ( SlotIndex );
+            return;
+            }
+
+        if (bIsTicking)
+            {
+            //  ,    
+            GetBucket ( slot.Group, slot.bThreadSafe )[ slot.DenseIndex ].SetEnabled ( false );
+            slot.bAlive = false;
+            PendingRemovals.push_back ( SlotIndex );
+            return;
+            }
+
+        RemoveFromGroup ( SlotIndex );
+        ReleaseSlot ( SlotIndex );
+        }
+
+    void CETickManager::MarkTickGraphsDirty ()
+        {
+        for (CETickGraph & graph : GroupTickGraphs)
+            {
+            graph.bDirty = true;
+            }
+        }
+
+    void CETickManager::RebuildTickGraph ( CETickGroup Group )
+        {
+        CETickGraph & graph = GroupTickGraphs[ static_cast< int >( Group ) ];
+        graph.bDirty = false;
+
+        //     
+        for (uint32 slotIndex : graph.NodeSlots)
+            {
+            const CETickSlot & slot = Slots[ slotIndex ];
+            if (slot.bAlive && slot.DenseIndex != PENDING_INDEX)
+                {
+                GetBucket ( slot.Group, slot.bThreadSafe )[ slot.DenseIndex ].bInTickGraph = false;
+                }
+            }
+
+        //     
+        Prerequisites.erase ( std::remove_if ( Prerequisites.begin (), Prerequisites.end (),
+                                               [ this ] ( const CETickPrerequisite & Entry )
+                                               {
+                                               return !IsHandleAlive ( Entry.Function ) || !IsHandleAlive ( Entry.Prerequisite );
+                                               } ),
+                              Prerequisites.end () );
+
+        // и ( , )  
+        std::vector<std::pair<uint32, uint32>> edges;
+        auto tryAddEdge = [ & ] ( CETickFunctionHandle Function, CETickFunctionHandle Prerequisite )
+            {
+            if (!IsHandleAlive ( Function ) || !IsHandleAlive ( Prerequisite ) || Function == Prerequisite) return;
+
+            const CETickSlot & functionSlot = Slots[ Function.Index ];
+            const CETickSlot & prerequisiteSlot = Slots[ Prerequisite.Index ];
+            if (functionSlot.Group != Group || prerequisiteSlot.Group != Group) return;
+
+            // ,    ,      
+            if (functionSlot.DenseIndex == PENDING_INDEX || prerequisiteSlot.DenseIndex == PENDING_INDEX)
+                {
+                graph.bDirty = true;
+                return;
+                }
+
+            edges.emplace_back ( Function.Index, Prerequisite.Index );
+            };
+
+        for (const CETickPrerequisite & entry : Prerequisites)
+            {
+            tryAddEdge ( entry.Function, entry.Prerequisite );
+            }
+
+        for (const CEOwnerTickPrerequisite & entry : OwnerPrerequisites)
+            {
+            auto ownerIt = OwnerHandles.find ( entry.Owner );
+            auto prerequisiteIt = OwnerHandles.find ( entry.PrerequisiteOwner );
+            if (ownerIt == OwnerHandles.end () || prerequisiteIt == OwnerHandles.end ()) continue;
+
+            for (const CETickFunctionHandle & function : ownerIt->second)
+                {
+                for (const CETickFunctionHandle & prerequisite : prerequisiteIt->second)
+                    {
+                    tryAddEdge ( function, prerequisite );
+                    }
+                }
+            }
+
+        graph.NodeSlots.clear ();
+        graph.PrerequisiteCounts.clear ();
+        graph.DependentOffsets.clear ();
+        graph.Dependents.clear ();
+        if (edges.empty ()) return;
+
+        //  
+        SlotToGraphNode.assign ( Slots.size (), UINT32_MAX );
+        auto getNode = [ & ] ( uint32 SlotIndex )
+            {
+            if (SlotToGraphNode[ SlotIndex ] == UINT32_MAX)
+                {
+                SlotToGraphNode[ SlotIndex ] = static_cast< uint32 >( graph.NodeSlots.size () );
+                graph.NodeSlots.push_back ( SlotIndex );
+                }
+            return SlotToGraphNode[ SlotIndex ];
+            };
+
+        for (auto & edge : edges)
+            {
+            edge.first = getNode ( edge.first );
+            edge.second = getNode ( edge.second );
+            }
+
+        //   ( + )     
+        std::sort ( edges.begin (), edges.end (),
+                    [] ( const auto & A, const auto & B ) { return A.second != B.second ? A.second < B.second : A.first < B.first; } );
+        edges.erase ( std::unique ( edges.begin (), edges.end () ), edges.end () );
+
+        uint32 nodeCount = static_cast< uint32 >( graph.NodeSlots.size () );
+        graph.PrerequisiteCounts.assign ( nodeCount, 0 );
+        graph.DependentOffsets.assign ( nodeCount + 1, 0 );
+        graph.Dependents.reserve ( edges.size () );
+
+        // и    - CSR   
+        for (const auto & edge : edges)
+            {
+            ++graph.PrerequisiteCounts[ edge.first ];
+            ++graph.DependentOffsets[ edge.second + 1 ];
+            graph.Dependents.push_back ( edge.first );
+            }
+        for (uint32 i = 0; i < nodeCount; ++i)
+            {
+            graph.DependentOffsets[ i + 1 ] += graph.DependentOffsets[ i ];
+            }
+
+        //    ( )
+        std::vector<uint32> remaining = graph.PrerequisiteCounts;
+        std::vector<uint32> ready;
+        for (uint32 i = 0; i < nodeCount; ++i)
+            {
+            if (remaining[ i ] == 0) ready.push_back ( i );
+            }
+
+        uint32 visited = 0;
+        while (!ready.empty ())
+            {
+            uint32 node = ready.back ();
+            ready.pop_back ();
+            ++visited;
+            for (uint32 e = graph.DependentOffsets[ node ]; e < graph.DependentOffsets[ node + 1 ]; ++e)
+                {
+                if (--remaining[ graph.Dependents[ e ] ] == 0) ready.push_back ( graph.Dependents[ e ] );
+                }
+            }
+
+        if (visited != nodeCount)
+            {
+            CE_ERROR ( "Tick group {} has a prerequisite cycle, dependencies in this group are ignored",
+                       static_cast< int >( Group ) );
+            graph.NodeSlots.clear ();
+            graph.PrerequisiteCounts.clear ();
+            graph.DependentOffsets.clear ();
+            graph.Dependents.clear ();
+            return;
+            }
+
+        for (uint32 slotIndex : graph.NodeSlots)
+            {
+            const CETickSlot & slot = Slots[ slotIndex ];
+            GetBucket ( slot.Group, slot.bThreadSafe )[ slot.DenseIndex ].bInTickGraph = true;
+            }
+
+        graph.RemainingPrerequisites = std::make_unique<std::atomic<uint32>[]> ( nodeCount );
+        graph.NodeFunctions.resize ( nodeCount );
+        }
+
+    void CETickManager::ReleaseSlot ( uint32 SlotIndex )
+        {
+        CETickSlot & slot = Slots[ SlotIndex ];
+        slot.bAlive = false;
+        slot.DenseIndex = PENDING_INDEX;
+        slot.Group = CETickGroup::MAX;
+        ++slot.Generation;
+        FreeSlots.push_back ( SlotIndex );
+        }
+
+    void CETickManager::FlushPendingChanges ()
+        {
+        for (uint32 slotIndex : PendingRemovals)
+            {
+            RemoveFromGroup ( slotIndex );
+            ReleaseSlot ( slotIndex );
+            }
+        PendingRemovals.clear ();
+
+        for (CETickFunction & tickFunc : PendingAdds)
+            {
+            AddToGroup ( std::move ( tickFunc ) );
+            }
+        PendingAdds.clear ();
+        }
+
     void CETickManager::SetTickGroupEnabled ( CETickGroup Group, bool bEnabled )
         {
         int groupIndex = static_cast< int >( Group );
@@ -89,9 +597,23 @@ namespace CE
             }
         }
 
+    void CETickManager::SetGroupEndStage ( CETickGroup Group, CETickDelegate Stage )
+        {
+        int groupIndex = static_cast< int >( Group );
+        if (groupIndex >= 0 && groupIndex < static_cast< int > ( CETickGroup::MAX ))
+            {
+            GroupEndStages[ groupIndex ] = std::move ( Stage );
+            }
+        }
+
     void CETickManager::Tick ( float DeltaTime )
         {
         float dilatedDelta = DeltaTime * TimeDilation;
+        auto frameStart = std::chrono::steady_clock::now ();
+
+        FrameTickedCount.store ( 0, std::memory_order_relaxed );
+        FrameIntervalTickedCount.store ( 0, std::memory_order_relaxed );
+        bIsTicking = true;
 
         //    
         for (int i = 0; i < static_cast< int > ( CETickGroup::MAX ); ++i)
@@ -102,30 +624,254 @@ namespace CE
                 }
             }
 
+        bIsTicking = false;
+        FlushPendingChanges ();
+
+        LastFrameStats.FrameNumber = FrameNumber;
+        LastFrameStats.FunctionsTicked = FrameTickedCount.load ( std::memory_order_relaxed );
+        LastFrameStats.IntervalFunctionsTicked = FrameIntervalTickedCount.load ( std::memory_order_relaxed );
+        LastFrameStats.TickTimeMs = std::chrono::duration<double, std::milli> ( std::chrono::steady_clock::now () - frameStart ).count ();
+        StatsHistory[ FrameNumber % STATS_HISTORY_SIZE ] = LastFrameStats;
+        ++FrameNumber;
+
        // CE_DEBUG ( "CETickManager processed {} tick groups", static_cast< int > ( CETickGroup::MAX ) );
         }
 
-    void CETickManager::ProcessTickGroup ( CETickGroup Group, float DeltaTime )
+    CETickCostHistogram CETickManager::BuildFrameCostHistogram ( uint32 BucketCount ) const
+        {
+        CETickCostHistogram histogram;
+        histogram.FrameCount = static_cast< uint32 >( std::min<uint64> ( FrameNumber, STATS_HISTORY_SIZE ) );
+        if (histogram.FrameCount == 0 || BucketCount == 0) return histogram;
+
+        histogram.MinTimeMs = StatsHistory[ 0 ].TickTimeMs;
+        histogram.MaxTimeMs = StatsHistory[ 0 ].TickTimeMs;
+        histogram.MinFunctionsTicked = StatsHistory[ 0 ].FunctionsTicked;
+        histogram.MaxFunctionsTicked = StatsHistory[ 0 ].FunctionsTicked;
+
+        double totalTime = 0.0;
+        for (uint32 i = 0; i < histogram.FrameCount; ++i)
+            {
+            const CETickFrameStats & frame = StatsHistory[ i ];
+            histogram.MinTimeMs = std::min ( histogram.MinTimeMs, frame.TickTimeMs );
+            histogram.MaxTimeMs = std::max ( histogram.MaxTimeMs, frame.TickTimeMs );
+            histogram.MinFunctionsTicked = std::min ( histogram.MinFunctionsTicked, frame.FunctionsTicked );
+            histogram.MaxFunctionsTicked = std::max ( histogram.MaxFunctionsTicked, frame.FunctionsTicked );
+            totalTime += frame.TickTimeMs;
+            }
+        histogram.AverageTimeMs = totalTime / histogram.FrameCount;
+
+        histogram.Buckets.assign ( BucketCount, 0 );
+        double range = histogram.MaxTimeMs - histogram.MinTimeMs;
+        histogram.BucketWidthMs = range > 0.0 ? range / BucketCount : 1.0;
+        for (uint32 i = 0; i < histogram.FrameCount; ++i)
+            {
+            uint32 bucket = static_cast< uint32 >( ( StatsHistory[ i ].TickTimeMs - histogram.MinTimeMs ) / histogram.BucketWidthMs );
+            ++histogram.Buckets[ std::min ( bucket, BucketCount - 1 ) ];
+            }
+        return histogram;
+        }
+
+    void CETickManager::PrintTickStats () const
         {
-            //  - 
-        for (auto & ownerPair : OwnerTickFunctions)
+        CETickCostHistogram histogram = BuildFrameCostHistogram ();
+        if (histogram.FrameCount == 0) return;
+
+        std::string safeName = GetName ();
+        CE_INFO ( "TickManager '{}': {} frames, time min/avg/max {:.3f}/{:.3f}/{:.3f} ms, functions per frame {}..{}",
+                  safeName, histogram.FrameCount, histogram.MinTimeMs, histogram.AverageTimeMs, histogram.MaxTimeMs,
+                  histogram.MinFunctionsTicked, histogram.MaxFunctionsTicked );
+
+        for (size_t i = 0; i < histogram.Buckets.size (); ++i)
             {
-            for (auto & tickFunc : ownerPair.second)
+            double bucketStart = histogram.MinTimeMs + histogram.BucketWidthMs * i;
+            CE_INFO ( "  [{:.3f} ms .. {:.3f} ms): {} frames",
+                      bucketStart, bucketStart + histogram.BucketWidthMs, histogram.Buckets[ i ] );
+            }
+        }
+
+    namespace
+        {
+        struct CEParallelTickContext
+            {
+            CETickFunction * Functions;
+            float DeltaTime;
+            std::atomic<uint32> * TickedCounter;
+            std::atomic<uint32> * IntervalTickedCounter;
+            };
+        }
+
+    void CETickManager::ExecuteParallelTicks ( void * Context, uint32 Begin, uint32 End )
+        {
+        auto * context = static_cast< CEParallelTickContext * >( Context );
+        uint32 ticked = 0;
+        uint32 intervalTicked = 0;
+        for (uint32 i = Begin; i < End; ++i)
+            {
+            CETickFunction & tickFunc = context->Functions[ i ];
+            if (!tickFunc.bInTickGraph && tickFunc.CanTick ( context->DeltaTime ))
                 {
-                if (tickFunc.GetTickGroup () == Group && tickFunc.CanTick ( DeltaTime ))
-                    {
-                    tickFunc.Execute ( DeltaTime );
-                    }
+                tickFunc.Execute ( context->DeltaTime );
+                ++ticked;
+                intervalTicked += tickFunc.TickInterval > 0.0f ? 1 : 0;
+                }
+            }
+
+        context->TickedCounter->fetch_add ( ticked, std::memory_order_relaxed );
+        context->IntervalTickedCounter->fetch_add ( intervalTicked, std::memory_order_relaxed );
+        }
+
+    void CETickManager::StartTickGraph ( CETickGraph & Graph, float DeltaTime )
+        {
+        uint32 nodeCount = static_cast< uint32 >( Graph.NodeSlots.size () );
+        Graph.DeltaTime = DeltaTime;
+        Graph.TickedCounter = &FrameTickedCount;
+        Graph.IntervalTickedCounter = &FrameIntervalTickedCount;
+        Graph.GameThreadReady.clear ();
+        Graph.RemainingNodes.store ( nodeCount, std::memory_order_relaxed );
+
+        for (uint32 i = 0; i < nodeCount; ++i)
+            {
+            const CETickSlot & slot = Slots[ Graph.NodeSlots[ i ] ];
+            Graph.NodeFunctions[ i ] = &GetBucket ( slot.Group, slot.bThreadSafe )[ slot.DenseIndex ];
+            Graph.RemainingPrerequisites[ i ].store ( Graph.PrerequisiteCounts[ i ], std::memory_order_relaxed );
+            }
+
+        for (uint32 i = 0; i < nodeCount; ++i)
+            {
+            if (Graph.PrerequisiteCounts[ i ] == 0)
+                {
+                ScheduleGraphNode ( Graph, i );
+                }
+            }
+        }
+
+    void CETickManager::FinishTickGraph ( CETickGraph & Graph )
+        {
+            //         ,    
+        while (Graph.RemainingNodes.load ( std::memory_order_acquire ) > 0)
+            {
+            uint32 node = UINT32_MAX;
+            {
+            std::lock_guard<std::mutex> lock ( Graph.GameThreadReadyMutex );
+            if (!Graph.GameThreadReady.empty ())
+                {
+                node = Graph.GameThreadReady.back ();
+                Graph.GameThreadReady.pop_back ();
                 }
             }
 
-            //  standalone -
-        for (auto & tickFunc : StandaloneTickFunctions)
+            if (node != UINT32_MAX)
+                {
+                ExecuteGraphNode ( Graph, node );
+                }
+            else if (!CEJobSystem::TryExecuteJob ())
+                {
+                std::this_thread::yield ();
+                }
+            }
+        }
+
+    void CETickManager::ExecuteGraphNode ( CETickGraph & Graph, uint32 Node )
+        {
+        CETickFunction & tickFunc = *Graph.NodeFunctions[ Node ];
+        if (tickFunc.CanTick ( Graph.DeltaTime ))
             {
-            if (tickFunc.GetTickGroup () == Group && tickFunc.CanTick ( DeltaTime ))
+            tickFunc.Execute ( Graph.DeltaTime );
+            Graph.TickedCounter->fetch_add ( 1, std::memory_order_relaxed );
+            if (tickFunc.TickInterval > 0.0f)
+                {
+                Graph.IntervalTickedCounter->fetch_add ( 1, std::memory_order_relaxed );
+                }
+            }
+
+        for (uint32 e = Graph.DependentOffsets[ Node ]; e < Graph.DependentOffsets[ Node + 1 ]; ++e)
+            {
+            uint32 dependent = Graph.Dependents[ e ];
+            if (Graph.RemainingPrerequisites[ dependent ].fetch_sub ( 1, std::memory_order_acq_rel ) == 1)
+                {
+                ScheduleGraphNode ( Graph, dependent );
+                }
+            }
+
+        Graph.RemainingNodes.fetch_sub ( 1, std::memory_order_release );
+        }
+
+    void CETickManager::ScheduleGraphNode ( CETickGraph & Graph, uint32 Node )
+        {
+        if (Graph.NodeFunctions[ Node ]->IsThreadSafe () && CEJobSystem::IsInitialized ())
+            {
+            CEJob job;
+            job.Function = &CETickManager::ExecuteGraphNodeJob;
+            job.Context = &Graph;
+            job.Begin = Node;
+            job.End = Node + 1;
+            CEJobSystem::Submit ( job );
+            }
+        else
+            {
+            std::lock_guard<std::mutex> lock ( Graph.GameThreadReadyMutex );
+            Graph.GameThreadReady.push_back ( Node );
+            }
+        }
+
+    void CETickManager::ExecuteGraphNodeJob ( void * Context, uint32 Begin, uint32 End )
+        {
+        ExecuteGraphNode ( *static_cast< CETickGraph * >( Context ), Begin );
+        }
+
+    void CETickManager::ProcessTickGroup ( CETickGroup Group, float DeltaTime )
+        {
+        CETickGroupBucket & bucket = GroupTickFunctions[ static_cast< int >( Group ) ];
+        CETickGraph & graph = GroupTickGraphs[ static_cast< int >( Group ) ];
+
+        if (graph.bDirty)
+            {
+            RebuildTickGraph ( Group );
+            }
+
+        //      
+        CEJobCounter parallelCounter;
+        CEParallelTickContext parallelContext { bucket.Parallel.data (), DeltaTime, &FrameTickedCount, &FrameIntervalTickedCount };
+        if (!bucket.Parallel.empty ())
+            {
+            CEJobSystem::Dispatch ( static_cast< uint32 >( bucket.Parallel.size () ), PARALLEL_TICK_GRAIN,
+                                    &CETickManager::ExecuteParallelTicks, &parallelContext, parallelCounter );
+            }
+
+            //        
+        bool bHasGraph = !graph.NodeSlots.empty ();
+        if (bHasGraph)
+            {
+            StartTickGraph ( graph, DeltaTime );
+            }
+
+            //      -      
+        uint32 ticked = 0;
+        uint32 intervalTicked = 0;
+        for (CETickFunction & tickFunc : bucket.GameThread)
+            {
+            if (!tickFunc.bInTickGraph && tickFunc.CanTick ( DeltaTime ))
                 {
                 tickFunc.Execute ( DeltaTime );
+                ++ticked;
+                intervalTicked += tickFunc.TickInterval > 0.0f ? 1 : 0;
                 }
             }
+        FrameTickedCount.fetch_add ( ticked, std::memory_order_relaxed );
+        FrameIntervalTickedCount.fetch_add ( intervalTicked, std::memory_order_relaxed );
+
+        if (bHasGraph)
+            {
+            FinishTickGraph ( graph );
+            }
+
+            //   - :        
+        CEJobSystem::Wait ( parallelCounter );
+
+        CETickDelegate & endStage = GroupEndStages[ static_cast< int >( Group ) ];
+        if (endStage)
+            {
+            endStage ( DeltaTime );
+            }
         }
-    }
\ No newline at end of file
+    }
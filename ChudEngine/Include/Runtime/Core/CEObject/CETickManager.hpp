@@ -1,9 +1,13 @@
 #pragma once
 
 #include "Core/CEObject/CEObject.hpp"
+#include "Core/CEObject/CEInlineFunction.hpp"
 #include <vector>
-#include <functional>
 #include <unordered_map>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <chrono>
 
 namespace CE
     {
@@ -16,10 +20,46 @@ namespace CE
         MAX
         };
 
+        // Stable handle to a registered tick function (survives swap-erase inside the buckets)
+    struct CETickFunctionHandle
+        {
+        uint32 Index = UINT32_MAX;
+        uint32 Generation = 0;
+
+        bool IsValid () const { return Index != UINT32_MAX; }
+        bool operator==( const CETickFunctionHandle & Other ) const { return Index == Other.Index && Generation == Other.Generation; }
+        };
+
+    //     
+    struct CETickFrameStats
+        {
+        uint64 FrameNumber = 0;
+        uint32 FunctionsTicked = 0;     //   
+        uint32 IntervalFunctionsTicked = 0;
+        double TickTimeMs = 0.0;
+        };
+
+    //      CETickManager::STATS_HISTORY_SIZE 
+    struct CETickCostHistogram
+        {
+        uint32 FrameCount = 0;
+        double MinTimeMs = 0.0;
+        double MaxTimeMs = 0.0;
+        double AverageTimeMs = 0.0;
+        uint32 MinFunctionsTicked = 0;
+        uint32 MaxFunctionsTicked = 0;
+        double BucketWidthMs = 0.0;
+        std::vector<uint32> Buckets; // Buckets[i] -    [Min + i*Width, Min + (i+1)*Width)
+        };
+
+    //  -:    CETickFunction,  
+    using CETickDelegate = CEInlineFunction<void ( float )>;
+
     class CETickFunction
         {
         public:
-            CETickFunction ( std::function<void ( float )> InFunction, CETickGroup InGroup, float InInterval = 0.0f );
+            CETickFunction ( CETickDelegate InFunction, CETickGroup InGroup, float InInterval = 0.0f,
+                             bool bInThreadSafe = false );
 
             void Execute ( float DeltaTime );
             bool CanTick ( float DeltaTime ); //  const!
@@ -31,12 +71,36 @@ namespace CE
             bool IsEnabled () const { return bEnabled; }
             void SetEnabled ( bool bEnable ) { bEnabled = bEnable; }
 
+            //          
+            bool IsThreadSafe () const { return bThreadSafe; }
+
+            CEObject * GetOwner () const { return Owner; }
+
+            //      
+            bool HasTickDependencies () const { return bInTickGraph; }
+
+            //        (. CETickManager::SetTickCost)
+            float GetTickCost () const { return TickCost; }
+
         private:
-            std::function<void ( float )> TickFunction;
+            friend class CETickManager;
+
+            CETickDelegate TickFunction;
             CETickGroup TickGroup;
             float TickInterval;
             float AccumulatedTime;
             bool bEnabled;
+            bool bThreadSafe;
+
+            //    
+            CEObject * Owner = nullptr;
+            uint32 SlotIndex = UINT32_MAX;
+            bool bInTickGraph = false;
+
+            //    (. CETickManager::AssignTickPhase)
+            uint16 PhaseLane = UINT16_MAX;
+            uint8 PhaseBin = 0;
+            float TickCost = 1.0f;
         };
 
     class CETickManager : public CEObject
@@ -45,24 +109,166 @@ namespace CE
             CETickManager ( const std::string & ManagerName = "CETickManager" );
             virtual ~CETickManager ();
 
-            //  -
-            void RegisterTickFunction ( CEObject * Owner, std::function<void ( float )> Function,
-                                        CETickGroup Group, float Interval = 0.0f );
+            //  - (   ).
+            // bThreadSafe:           ;
+            //        -.
+            CETickFunctionHandle RegisterTickFunction ( CEObject * Owner, CETickDelegate Function,
+                                                        CETickGroup Group, float Interval = 0.0f,
+                                                        bool bThreadSafe = false );
+            void UnregisterTickFunction ( CETickFunctionHandle Handle );
             void UnregisterTickFunctions ( CEObject * Owner );
 
+            //   : Function   Prerequisite.
+            //       ,    - .
+            void AddTickPrerequisite ( CETickFunctionHandle Function, CETickFunctionHandle Prerequisite );
+            void RemoveTickPrerequisite ( CETickFunctionHandle Function, CETickFunctionHandle Prerequisite );
+
+            //   Owner    PrerequisiteOwner    
+            // ( ,  )
+            void AddTickPrerequisite ( CEObject * Owner, CEObject * PrerequisiteOwner );
+            void RemoveTickPrerequisite ( CEObject * Owner, CEObject * PrerequisiteOwner );
+
+            //    (nullptr   )
+            CETickFunction * GetTickFunction ( CETickFunctionHandle Handle );
+            size_t GetTickFunctionCount ( CETickGroup Group ) const;
+
+            //        (  1).
+            //     ,     ,    
+            //       .       .
+            void SetTickCost ( CETickFunctionHandle Handle, float Cost );
+
             //  
             void SetTickGroupEnabled ( CETickGroup Group, bool bEnabled );
+
+            //    ,   :    ,   -
+            // ,       ,  .
+            //    , nullptr  
+            void SetGroupEndStage ( CETickGroup Group, CETickDelegate Stage );
             void SetWorldTimeDilation ( float Dilation ) { TimeDilation = Dilation; }
 
             //   
            virtual void Tick ( float DeltaTime ) override;
 
+            // 
+            const CETickFrameStats & GetLastFrameStats () const { return LastFrameStats; }
+            CETickCostHistogram BuildFrameCostHistogram ( uint32 BucketCount = 8 ) const;
+            void PrintTickStats () const;
+
+            static constexpr uint32 STATS_HISTORY_SIZE = 128;
+            static constexpr uint32 PHASE_BINS = 128;
+
         private:
-            std::unordered_map<CEObject *, std::vector<CETickFunction>> OwnerTickFunctions;
-            std::vector<CETickFunction> StandaloneTickFunctions;
+            static constexpr uint32 PENDING_INDEX = UINT32_MAX;
+            static constexpr uint32 PARALLEL_TICK_GRAIN = 64;
+
+            //  :       
+            struct CETickSlot
+                {
+                uint32 Generation = 0;
+                uint32 DenseIndex = PENDING_INDEX;
+                CETickGroup Group = CETickGroup::MAX;
+                bool bThreadSafe = false;
+                bool bAlive = false;
+                };
+
+            //     -       .
+            //    ,     .
+            struct CETickGroupBucket
+                {
+                std::vector<CETickFunction> GameThread;
+                std::vector<CETickFunction> Parallel;
+                };
+
+            struct CETickPrerequisite
+                {
+                CETickFunctionHandle Function;
+                CETickFunctionHandle Prerequisite;
+                };
+
+            struct CEOwnerTickPrerequisite
+                {
+                CEObject * Owner;
+                CEObject * PrerequisiteOwner;
+                };
+
+            // DAG  .   ( )    
+            //     .
+            struct CETickGraph
+                {
+                std::vector<uint32> NodeSlots;
+                std::vector<uint32> PrerequisiteCounts;
+                std::vector<uint32> DependentOffsets; // CSR:   i  Dependents[Offsets[i], Offsets[i+1])
+                std::vector<uint32> Dependents;
+                bool bDirty = false;
+
+                //   
+                std::vector<CETickFunction *> NodeFunctions;
+                std::unique_ptr<std::atomic<uint32>[]> RemainingPrerequisites;
+                std::atomic<uint32> RemainingNodes { 0 };
+                std::mutex GameThreadReadyMutex;
+                std::vector<uint32> GameThreadReady;
+                float DeltaTime = 0.0f;
+                std::atomic<uint32> * TickedCounter = nullptr;
+                std::atomic<uint32> * IntervalTickedCounter = nullptr;
+                };
+
+            //        PHASE_BINS  ,
+            //           .
+            //  :  ,   ,    
+            //  ,         .
+            struct CETickIntervalLane
+                {
+                float Interval = 0.0f;
+                float BinLoad[ PHASE_BINS ] = {};
+                };
+
+            CETickGroupBucket GroupTickFunctions[ static_cast< int >( CETickGroup::MAX ) ];
+            CETickGraph GroupTickGraphs[ static_cast< int >( CETickGroup::MAX ) ];
+            std::vector<CETickSlot> Slots;
+            std::vector<uint32> FreeSlots;
+
+            std::vector<CETickPrerequisite> Prerequisites;
+            std::vector<CEOwnerTickPrerequisite> OwnerPrerequisites;
+            std::vector<uint32> SlotToGraphNode; //    
+            std::vector<CETickIntervalLane> IntervalLanes;
+
+            //   ( )
+            std::atomic<uint32> FrameTickedCount { 0 };
+            std::atomic<uint32> FrameIntervalTickedCount { 0 };
+            CETickFrameStats LastFrameStats;
+            CETickFrameStats StatsHistory[ STATS_HISTORY_SIZE ];
+            uint64 FrameNumber = 0;
+
+            //       ,    
+            std::unordered_map<CEObject *, std::vector<CETickFunctionHandle>> OwnerHandles;
+
+            //        
+            std::vector<CETickFunction> PendingAdds;
+            std::vector<uint32> PendingRemovals;
+            bool bIsTicking = false;
+
             bool bTickGroupsEnabled[ static_cast< int >( CETickGroup::MAX ) ];
+            CETickDelegate GroupEndStages[ static_cast< int >( CETickGroup::MAX ) ];
             float TimeDilation;
 
             void ProcessTickGroup ( CETickGroup Group, float DeltaTime );
+            static void ExecuteParallelTicks ( void * Context, uint32 Begin, uint32 End );
+            void RebuildTickGraph ( CETickGroup Group );
+            void MarkTickGraphsDirty ();
+            void StartTickGraph ( CETickGraph & Graph, float DeltaTime );
+            void FinishTickGraph ( CETickGraph & Graph );
+            static void ExecuteGraphNode ( CETickGraph & Graph, uint32 Node );
+            static void ScheduleGraphNode ( CETickGraph & Graph, uint32 Node );
+            static void ExecuteGraphNodeJob ( void * Context, uint32 Begin, uint32 End );
+            std::vector<CETickFunction> & GetBucket ( CETickGroup Group, bool bThreadSafe );
+            bool IsHandleAlive ( CETickFunctionHandle Handle ) const;
+            CETickFunction * FindSlotFunction ( uint32 SlotIndex );
+            void AssignTickPhase ( CETickFunction & Function );
+            void ReleaseTickPhase ( CETickFunction & Function );
+            void AddToGroup ( CETickFunction && Function );
+            void RemoveFromGroup ( uint32 SlotIndex );
+            void UnregisterSlot ( uint32 SlotIndex );
+            void ReleaseSlot ( uint32 SlotIndex );
+            void FlushPendingChanges ();
         };
-    }
\ No newline at end of file
+    }
@@ -1,12 +1,33 @@
 #include "Core/CEObject/CEWorld.hpp"
 
+#include "Core/CEObject/Components/CETransformComponent.hpp"
+#include "Core/Jobs/CEJobSystem.hpp"
 #include "Utils/Logger.hpp"
 #include <algorithm>
 
 namespace CE
     {
+    namespace
+        {
+        //   BeginPlay       
+        constexpr uint32 MIN_PARALLEL_BEGIN_PLAY = 64;
+        constexpr uint32 BEGIN_PLAY_GRAIN = 16;
+
+        // reserve  ,        
+        template<typename VectorType>
+        void ReserveAdditional ( VectorType & Vector, size_t Count )
+            {
+            size_t required = Vector.size () + Count;
+            if (required > Vector.capacity ())
+                {
+                Vector.reserve ( std::max ( required, Vector.capacity () * 2 ) );
+                }
+            }
+        }
+
     CEWorld::CEWorld ( const std::string & WorldName ) 
-        : CEObject(WorldName), TickManager ( new CETickManager (WorldName+" tickManager"))
+        : CEObject(WorldName), TickManager ( new CETickManager (WorldName+" tickManager")),
+        EventSystem ( new CEEventSystem () )
         {       
         std::string safeName = GetName ();
         CE_DEBUG ( "CEWorld '{}' created", safeName );
@@ -16,6 +37,7 @@ namespace CE
         {
         std::string safeName = GetName ();
         CE_DEBUG ( "CEWorld '{}' destructor started with {} actors", safeName, Actors.size () );
+        ComponentRegistries.clear ();
 
         //      
         for (auto it = Actors.rbegin (); it != Actors.rend (); ++it)
@@ -43,16 +65,16 @@ namespace CE
             }
         PendingActors.clear ();
 
-        for (CEActor * Actor : PendingKillActors)
+        //        Actors    
+        PendingKillActors.clear ();
+
+        ClearActorPools ();
+
+        if (EventSystem)
             {
-            if (Actor)
-                {
-                std::string actorName = Actor->GetName ();
-                delete Actor;
-                CE_DEBUG ( "Cleaned pending kill actor: {}", actorName );
-                }
+            delete EventSystem;
+            EventSystem = nullptr;
             }
-        PendingKillActors.clear ();
 
         //  TickManager
         if (TickManager)
@@ -74,14 +96,31 @@ namespace CE
             }
         }
 
+    void CEWorld::SpawnActors ( std::span<CEActor * const> NewActors )
+        {
+        ReservePendingActors ( NewActors.size () );
+        for (CEActor * Actor : NewActors)
+            {
+            if (Actor)
+                {
+                PendingActors.push_back ( Actor );
+                }
+            }
+        CE_DEBUG ( "CEWorld: {} actors scheduled for spawn", NewActors.size () );
+        }
+
     void CEWorld::DestroyActor ( CEActor * Actor )
         {
-        if (Actor && std::find ( Actors.begin (), Actors.end (), Actor ) != Actors.end ())
+            //    ;    ProcessPendingKills 
+        if (!Actor || Actor->bPendingWorldKill || Actor->WorldIndex >= Actors.size ()
+             || Actors[ Actor->WorldIndex ] != Actor)
             {
-            PendingKillActors.push_back ( Actor );
-            std::string actorName = Actor->GetName ();
-            CE_DEBUG ( "CEWorld: Actor '{}' scheduled for destruction", actorName );
+            return;
             }
+
+        Actor->bPendingWorldKill = true;
+        PendingKillActors.push_back ( Actor );
+        CE_DEBUG ( "CEWorld: Actor '{}' scheduled for destruction", Actor->GetName () );
         }
 
     void CEWorld::BeginPlay ()
@@ -114,8 +153,15 @@ namespace CE
                 {
                 Actor->Tick ( DeltaTime );
                 }
-            }              
-      
+            }
+
+        UpdateEntityTransforms ();
+
+        //  ,     ,   
+        if (EventSystem)
+            {
+            EventSystem->DispatchQueuedEvents ();
+            }
         }
 
     void CEWorld::Destroy ()
@@ -129,23 +175,96 @@ namespace CE
         {
         if (PendingActors.empty ()) return;
 
-        CE_DEBUG ( "CEWorld: Spawning {} pending actors", PendingActors.size () );
+            //   : ,   BeginPlay,      
+        SpawnBatch.swap ( PendingActors );
+        CE_DEBUG ( "CEWorld: Spawning {} pending actors", SpawnBatch.size () );
 
-        for (CEActor * Actor : PendingActors)
+        ReserveForSpawnBatch ();
+
+        ThreadSafeBeginPlay.clear ();
+        for (CEActor * Actor : SpawnBatch)
             {
-            if (Actor)
+                // TickManager  World   BeginPlay
+            Actor->SetTickManager ( TickManager );
+            Actor->SetWorld ( this );
+
+            RegisterActorComponents ( Actor );
+            if (bEntityStorageEnabled)
                 {
-                    //  TickManager  World    BeginPlay
-                Actor->SetTickManager ( TickManager );
-                Actor->SetWorld ( this );  //   !
+                CreateActorEntity ( Actor );
+                }
 
-                Actors.push_back ( Actor );
-                Actor->BeginPlay (); //  BeginPlay  RegisterTickFunctions()
-                std::string actorName = Actor->GetName ();
-                CE_DEBUG ( "CEWorld: Actor '{}' spawned", actorName );
+            Actor->WorldIndex = static_cast< uint32 >( Actors.size () );
+            Actors.push_back ( Actor );
+
+            if (Actor->bBeginPlayThreadSafe)
+                {
+                ThreadSafeBeginPlay.push_back ( Actor );
+                }
+            }
+
+            // BeginPlay ,      :  - ,
+            //  -      
+        bool bParallel = ThreadSafeBeginPlay.size () >= MIN_PARALLEL_BEGIN_PLAY && CEJobSystem::IsInitialized ();
+        if (bParallel)
+            {
+            CEJobSystem::ParallelFor ( static_cast< uint32 >( ThreadSafeBeginPlay.size () ), BEGIN_PLAY_GRAIN,
+                                       [ this ] ( uint32 Index ) { ThreadSafeBeginPlay[ Index ]->BeginPlay (); } );
+            }
+
+        for (CEActor * Actor : SpawnBatch)
+            {
+            if (!bParallel || !Actor->bBeginPlayThreadSafe)
+                {
+                Actor->BeginPlay ();
+                }
+            }
+
+        SpawnBatch.clear ();
+        ThreadSafeBeginPlay.clear ();
+        }
+
+    void CEWorld::ReservePendingActors ( size_t Count )
+        {
+        ReserveAdditional ( PendingActors, Count );
+        }
+
+    void CEWorld::ReserveForSpawnBatch ()
+        {
+        ReserveAdditional ( Actors, SpawnBatch.size () );
+        if (bEntityStorageEnabled)
+            {
+            EntityStorage.ReserveEntities ( static_cast< uint32 >( SpawnBatch.size () ) );
+            }
+
+            //       ,     
+        std::vector<size_t> batchCounts ( ComponentRegistries.size (), 0 );
+        for (CEActor * Actor : SpawnBatch)
+            {
+            if (Actor->ComponentsByType.IsEmpty ()) continue;
+
+                //  ,  -   ID 
+            if (Actor->ComponentsByType.Back ().TypeId >= batchCounts.size ())
+                {
+                batchCounts.resize ( Actor->ComponentsByType.Back ().TypeId + 1, 0 );
+                }
+            for (const CEActor::CEComponentTypeEntry & entry : Actor->ComponentsByType)
+                {
+                ++batchCounts[ entry.TypeId ];
+                }
+            }
+
+        if (batchCounts.size () > ComponentRegistries.size ())
+            {
+            ComponentRegistries.resize ( batchCounts.size () );
+            }
+        for (CEComponentTypeId typeId = 0; typeId < batchCounts.size (); ++typeId)
+            {
+            if (batchCounts[ typeId ] > 0)
+                {
+                ReserveAdditional ( ComponentRegistries[ typeId ], batchCounts[ typeId ] );
                 }
             }
-        PendingActors.clear ();
         }
 
     void CEWorld::ProcessPendingKills ()
@@ -154,20 +273,234 @@ namespace CE
 
         CE_DEBUG ( "CEWorld: Destroying {} pending actors", PendingKillActors.size () );
 
+        //    : swap-and-pop   ,     .
+        //        .
         for (CEActor * Actor : PendingKillActors)
             {
-            if (!Actor) continue;
+            uint32 index = Actor->WorldIndex;
+            CEActor * last = Actors.back ();
+            Actors[ index ] = last;
+            last->WorldIndex = index;
+            Actors.pop_back ();
+            Actor->WorldIndex = UINT32_MAX;
 
-            std::string actorName = Actor->GetName ();
-            auto it = std::find ( Actors.begin (), Actors.end (), Actor );
-            if (it != Actors.end ())
+            UnregisterActorComponents ( Actor );
+            DestroyActorEntity ( Actor );
+            Actor->Destroy (); //  Destroy  UnregisterTickFunctions()
+
+            if (Actor->bPooled)
+                {
+                RecycleActor ( Actor );
+                }
+            else
                 {
-                Actors.erase ( it );
-                Actor->Destroy (); //  Destroy  UnregisterTickFunctions()
                 delete Actor;
-                CE_DEBUG ( "CEWorld: Actor '{}' destroyed", actorName );
                 }
             }
         PendingKillActors.clear ();
         }
-    }
\ No newline at end of file
+
+    void CEWorld::RegisterComponent ( CEComponent * Component, CEComponentTypeId TypeId )
+        {
+        if (TypeId >= ComponentRegistries.size ())
+            {
+            ComponentRegistries.resize ( TypeId + 1 );
+            }
+
+        std::vector<CEComponent *> & registry = ComponentRegistries[ TypeId ];
+        Component->WorldRegistrySlot = static_cast< uint32 >( registry.size () );
+        registry.push_back ( Component );
+        }
+
+    void CEWorld::UnregisterComponent ( CEComponent * Component, CEComponentTypeId TypeId )
+        {
+        if (TypeId >= ComponentRegistries.size () || Component->WorldRegistrySlot == UINT32_MAX) return;
+
+            // swap-and-pop   
+        std::vector<CEComponent *> & registry = ComponentRegistries[ TypeId ];
+        CEComponent * last = registry.back ();
+        registry[ Component->WorldRegistrySlot ] = last;
+        last->WorldRegistrySlot = Component->WorldRegistrySlot;
+        registry.pop_back ();
+        Component->WorldRegistrySlot = UINT32_MAX;
+        }
+
+    void CEWorld::RegisterActorComponents ( CEActor * Actor )
+        {
+        for (const CEActor::CEComponentTypeEntry & entry : Actor->ComponentsByType)
+            {
+            RegisterComponent ( entry.Component, entry.TypeId );
+            }
+        }
+
+    void CEWorld::UnregisterActorComponents ( CEActor * Actor )
+        {
+        for (const CEActor::CEComponentTypeEntry & entry : Actor->ComponentsByType)
+            {
+            UnregisterComponent ( entry.Component, entry.TypeId );
+            }
+        }
+
+    void CEWorld::SetEntityStorageEnabled ( bool bEnable )
+        {
+        if (bEntityStorageEnabled == bEnable) return;
+
+        bEntityStorageEnabled = bEnable;
+        for (CEActor * Actor : Actors)
+            {
+            if (bEnable)
+                {
+                CreateActorEntity ( Actor );
+                }
+            else
+                {
+                DestroyActorEntity ( Actor );
+                }
+            }
+        CE_DEBUG ( "CEWorld '{}': entity storage {}", GetName (), bEnable ? "enabled" : "disabled" );
+        }
+
+    void CEWorld::CreateActorEntity ( CEActor * Actor )
+        {
+        Actor->Entity = EntityStorage.CreateEntity ( CEActorData { Actor }, CETransformData {}, CEWorldTransformData {} );
+
+        for (auto & Component : Actor->Components)
+            {
+            BindComponentEntity ( Component.get (), Actor->Entity );
+            }
+        }
+
+    void CEWorld::DestroyActorEntity ( CEActor * Actor )
+        {
+        if (!Actor->Entity.IsValid ()) return;
+
+            //        
+        for (auto & Component : Actor->Components)
+            {
+            Component->UnbindEntity ();
+            }
+        EntityStorage.DestroyEntity ( Actor->Entity );
+        Actor->Entity = CEEntity ();
+        }
+
+    void CEWorld::BindComponentEntity ( CEComponent * Component, CEEntity Entity )
+        {
+        Component->BindEntity ( EntityStorage, Entity );
+        }
+
+    void CEWorld::UpdateEntityTransforms ()
+        {
+        if (!bEntityStorageEnabled) return;
+
+        Query<CETransformData, CEWorldTransformData, const CEActorData> ().ForEachChunk (
+            [] ( uint32 Count, const CEEntity *, CETransformData * Transforms, CEWorldTransformData * WorldTransforms,
+                 const CEActorData * ActorData )
+            {
+            for (uint32 i = 0; i < Count; ++i)
+                {
+                CETransformData & transform = Transforms[ i ];
+                if (!transform.bDirty) continue;
+
+                    //    :   
+                WorldTransforms[ i ].Matrix = transform.bHasParent
+                    ? ActorData[ i ].Actor->GetTransform ()->GetWorldTransform ()
+                    : CETransformComponent::ComposeLocalTransform ( transform );
+                transform.bDirty = false;
+                ActorData[ i ].Actor->GetTransform ()->InvalidateCachedTransform ();
+                }
+            } );
+        }
+
+    void CEWorld::RegisterSystemTick ( CETickGroup Group )
+        {
+        bool & bRegistered = bSystemStageRegistered[ static_cast< int >( Group ) ];
+        if (bRegistered || !TickManager) return;
+
+            //     : -,       
+            // ,     ,      
+        TickManager->SetGroupEndStage ( Group, [ this, Group ] ( float DeltaTime )
+                                        {
+                                        SystemScheduler.RunGroup ( Group, DeltaTime );
+                                        } );
+        bRegistered = true;
+        }
+
+    void CEWorld::RecycleActor ( CEActor * Actor )
+        {
+            // -      BeginPlay
+        if (TickManager)
+            {
+            TickManager->UnregisterTickFunctions ( Actor );
+            }
+        Actor->SetWorld ( nullptr );
+
+            //    :         
+        if (CETransformComponent * transform = Actor->GetTransform ())
+            {
+            std::vector<CETransformComponent *> children = transform->GetChildren ();
+            for (CETransformComponent * child : children)
+                {
+                child->SetParent ( nullptr );
+                }
+            transform->SetParent ( nullptr );
+            }
+
+        CEObject::DetachFromRegistries ( Actor );
+        for (auto & component : Actor->Components)
+            {
+            CEObject::DetachFromRegistries ( component.get () );
+            }
+
+        CEActorPool & pool = ActorPools[ Actor->GetClass () ];
+        pool.FreeActors.push_back ( Actor );
+        ++pool.Stats.Recycled;
+        }
+
+    uint64 CEWorld::GetActorIDSpan ( const CEActor * Actor )
+        {
+        uint64 lastID = Actor->GetUniqueID ();
+        for (const auto & component : Actor->Components)
+            {
+            lastID = std::max ( lastID, component->GetUniqueID () );
+            }
+        return lastID - Actor->GetUniqueID () + 1;
+        }
+
+    void CEWorld::ReusePooledActor ( CEActor * Actor )
+        {
+        CEObject::AttachToRegistries ( Actor );
+        for (auto & component : Actor->Components)
+            {
+            CEObject::AttachToRegistries ( component.get () );
+            }
+
+        Actor->PrepareForReuse ();
+        }
+
+    CEActorPoolStats CEWorld::GetActorPoolStats ( const CEClass * Class ) const
+        {
+        CEActorPoolStats total;
+        for (const auto & [poolClass, pool] : ActorPools)
+            {
+            if (Class && poolClass != Class) continue;
+
+            total.Hits += pool.Stats.Hits;
+            total.Misses += pool.Stats.Misses;
+            total.Recycled += pool.Stats.Recycled;
+            total.FreeActors += static_cast< uint32 >( pool.FreeActors.size () );
+            }
+        return total;
+        }
+
+    void CEWorld::ClearActorPools ()
+        {
+        for (auto & [poolClass, pool] : ActorPools)
+            {
+            for (CEActor * Actor : pool.FreeActors)
+                {
+                delete Actor;
+                }
+            pool.FreeActors.clear ();
+            }
+        }
+    }
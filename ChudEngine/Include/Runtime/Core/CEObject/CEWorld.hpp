@@ -3,16 +3,33 @@
 #include "Core/CEObject/CEObject.hpp"
 #include "Core/CEObject/CEActor.hpp"
 #include "Core/CEObject/CETickManager.hpp"  
+#include "Core/CEObject/CEEventSystem.hpp"
+#include "Core/ECS/CEEntityStorage.hpp"
+#include "Core/ECS/CEEntityData.hpp"
+#include "Core/ECS/CEEntitySystem.hpp"
+#include "Core/Memory/CEFrameAllocator.hpp"
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <span>
 
 namespace CE
     {
     class CEActor;
 
+    //    (    )
+    struct CEActorPoolStats
+        {
+        uint64 Hits = 0;       //     
+        uint64 Misses = 0;     //   ,   
+        uint64 Recycled = 0;   //  ,   
+        uint32 FreeActors = 0; //    
+        };
+
     class CEWorld : public CEObject
         {
+        DECLARE_CLASS ( CEWorld, CEObject )
+
         public:
             CEWorld ( const std::string & WorldName = "MainWorld" );
             virtual ~CEWorld ();
@@ -20,15 +37,130 @@ namespace CE
             //  
             void SpawnActor ( CEActor * Actor );
             void DestroyActor ( CEActor * Actor );
+
+            //  :      ,      
+            void SpawnActors ( std::span<CEActor * const> NewActors );
+
+            //  Count  T ( Args... )       . ID   
+            //       ;  T   ,  ,
+            //     ,        
+            template<typename T, typename... ArgTypes>
+            std::vector<T *> SpawnActors ( uint32 Count, const ArgTypes &... Args )
+                {
+                static_assert( std::is_base_of_v<CEActor, T>, "T must inherit from CEActor" );
+
+                std::vector<T *> spawned;
+                spawned.reserve ( Count );
+                ReservePendingActors ( Count );
+
+                CEObject::ReserveIDs ( static_cast< uint64 >( Count ) * MIN_IDS_PER_ACTOR );
+                for (uint32 i = 0; i < Count; ++i)
+                    {
+                    T * actor = new T ( Args... );
+                    spawned.push_back ( actor );
+                    PendingActors.push_back ( actor );
+
+                    if (i == 0)
+                        {
+                        uint64 idsPerActor = GetActorIDSpan ( actor );
+                        if (idsPerActor > MIN_IDS_PER_ACTOR)
+                            {
+                            CEObject::ReserveIDs ( static_cast< uint64 >( Count - 1 ) * idsPerActor );
+                            }
+                        }
+                    }
+                return spawned;
+                }
+
+            //   :    T  ,       .
+            //    Reset ()     BeginPlay; Args    .
+            //    ,       FindObjectByName/FindObjectsOfType.
+            template<typename T, typename... ArgTypes>
+            T * SpawnPooledActor ( ArgTypes &&... Args )
+                {
+                static_assert( std::is_base_of_v<CEActor, T>, "T must inherit from CEActor" );
+                static_assert( CEIsDeclaredClass<T>::value, "Pooled actor classes need DECLARE_CLASS" );
+
+                CEActorPool & pool = ActorPools[ T::StaticClass () ];
+                T * actor = nullptr;
+                if (!pool.FreeActors.empty ())
+                    {
+                    actor = static_cast< T * >( pool.FreeActors.back () );
+                    pool.FreeActors.pop_back ();
+                    ReusePooledActor ( actor );
+                    ++pool.Stats.Hits;
+                    }
+                else
+                    {
+                    actor = new T ( std::forward<ArgTypes> ( Args )... );
+                    actor->bPooled = true;
+                    ++pool.Stats.Misses;
+                    }
+
+                SpawnActor ( actor );
+                return actor;
+                }
+
+            //   Count   T   (,   )
+            template<typename T, typename... ArgTypes>
+            void PrewarmActorPool ( uint32 Count, const ArgTypes &... Args )
+                {
+                static_assert( CEIsDeclaredClass<T>::value, "Pooled actor classes need DECLARE_CLASS" );
+
+                CEActorPool & pool = ActorPools[ T::StaticClass () ];
+                pool.FreeActors.reserve ( pool.FreeActors.size () + Count );
+                for (uint32 i = 0; i < Count; ++i)
+                    {
+                    T * actor = new T ( Args... );
+                    actor->bPooled = true;
+                    pool.FreeActors.push_back ( actor );
+                    }
+                }
+
+            // Class == nullptr -    
+            CEActorPoolStats GetActorPoolStats ( const CEClass * Class = nullptr ) const;
+            void ClearActorPools ();
            
+            //     T    ,  .
+            //     /   .
+            template<typename T>
+            CEComponentRange<T> GetComponentRange () const
+                {
+                CEComponentTypeId typeId = GetComponentTypeId<T> ();
+                if (typeId >= ComponentRegistries.size ()) return {};
+
+                const std::vector<CEComponent *> & registry = ComponentRegistries[ typeId ];
+                return CEComponentRange<T> ( registry.data (), registry.size () );
+                }
+
+            //  T   ,       :
+            //    ,       (. CEFrameAllocator)
             template<typename T>
-            std::vector<T *> GetComponentsOfType ()
+            CEFrameVector<T *> GetComponentsOfType () const
                 {
-                std::vector<T *> components;
-                for (auto * actor : Actors)
+                static_assert( std::is_base_of_v<CEComponent, T>, "T must inherit from CEComponent" );
+
+                    //     ,      
+                size_t count = 0;
+                for (const std::vector<CEComponent *> & registry : ComponentRegistries)
                     {
-                    auto actorComponents = actor->GetComponentsOfType<T> ();
-                    components.insert ( components.end (), actorComponents.begin (), actorComponents.end () );
+                    if (!registry.empty () && registry[ 0 ]->CastTo<T> ())
+                        {
+                        count += registry.size ();
+                        }
+                    }
+
+                CEFrameVector<T *> components;
+                components.reserve ( count );
+                for (const std::vector<CEComponent *> & registry : ComponentRegistries)
+                    {
+                    if (!registry.empty () && registry[ 0 ]->CastTo<T> ())
+                        {
+                        for (CEComponent * component : registry)
+                            {
+                            components.push_back ( static_cast< T * >( component ) );
+                            }
+                        }
                     }
                 return components;
                 }
@@ -37,9 +169,12 @@ namespace CE
             template<typename T>
             T * FindActorByName ( const std::string & Name )
                 {
+                FName ActorName = FName::FindExisting ( Name );
+                if (ActorName.IsNone () && !Name.empty ()) return nullptr;
+
                 for (CEActor * Actor : Actors)
                     {
-                    if (Actor->GetName () == Name)
+                    if (Actor->GetFName () == ActorName)
                         {
                         return Actor->CastTo<T>();
                         }
@@ -63,9 +198,48 @@ namespace CE
                 return result;
                 }
 
+            // Data-oriented  (  ). ,    
+            //  CEActorData, CETransformData  CEWorldTransformData,       .
+            //      : Query<CETransformData, CEMeshData> ()
+            void SetEntityStorageEnabled ( bool bEnable );
+            bool IsEntityStorageEnabled () const { return bEntityStorageEnabled; }
+            CEEntityStorage & GetEntityStorage () { return EntityStorage; }
+
+            template<typename... Ts>
+            CEEntityQuery<Ts...> Query () { return EntityStorage.Query<Ts...> (); }
+
+            //  CEWorldTransformData   (  Tick)
+            void UpdateEntityTransforms ();
+
+            //    .       
+            //   (CETickManager::SetGroupEndStage),    - ;
+            //        .
+            template<typename SystemType, typename... ArgTypes>
+            SystemType * AddSystem ( ArgTypes &&... Args )
+                {
+                SystemType * system = SystemScheduler.AddSystem<SystemType> ( std::forward<ArgTypes> ( Args )... );
+                RegisterSystemTick ( system->GetTickGroup () );
+                return system;
+                }
+
+            // AddSystemFunction<CERead<A>, CEWrite<B>> ( "Name", Group, [] ( float, const A &, B & ) { } )
+            template<typename... Accesses, typename FunctionType>
+            CEEntitySystemBase * AddSystemFunction ( const std::string & Name, CETickGroup Group, FunctionType && Function )
+                {
+                CEEntitySystemBase * system = SystemScheduler.AddSystemFunction<Accesses...> ( Name, Group, std::forward<FunctionType> ( Function ) );
+                RegisterSystemTick ( Group );
+                return system;
+                }
+
+            void RemoveSystem ( CEEntitySystemBase * System ) { SystemScheduler.RemoveSystem ( System ); }
+            CEEntitySystemScheduler & GetSystemScheduler () { return SystemScheduler; }
+
                 // Tick 
             CETickManager * GetTickManager () const { return TickManager; }
 
+            //  :      Tick
+            CEEventSystem * GetEventSystem () const { return EventSystem; }
+
             // 
             size_t GetActorCount () const { return Actors.size (); }
             size_t GetPendingSpawnCount () const { return PendingActors.size (); }
@@ -76,11 +250,44 @@ namespace CE
             virtual void Destroy () override;
             const std::vector<CEActor *> & GetActors () const { return Actors; }
         private:
+            friend class CEActor;
+
             std::vector<CEActor *> Actors;
+            std::vector<std::vector<CEComponent *>> ComponentRegistries; //  - CEComponentTypeId
             std::vector<CEActor *> PendingActors;
+            std::vector<CEActor *> SpawnBatch;           // ,  ProcessPendingSpawns
+            std::vector<CEActor *> ThreadSafeBeginPlay;  //     BeginPlay
             std::vector<CEActor *> PendingKillActors;
             CETickManager * TickManager;  //  TickManager
+            CEEventSystem * EventSystem;
+            CEEntityStorage EntityStorage;
+            bool bEntityStorageEnabled = false;
+            CEEntitySystemScheduler SystemScheduler { EntityStorage };
+            bool bSystemStageRegistered[ static_cast< int >( CETickGroup::MAX ) ] = {};
+
+            struct CEActorPool
+                {
+                std::vector<CEActor *> FreeActors;
+                CEActorPoolStats Stats;
+                };
+            std::unordered_map<const CEClass *, CEActorPool> ActorPools;
+
+            void RegisterComponent ( CEComponent * Component, CEComponentTypeId TypeId );
+            void UnregisterComponent ( CEComponent * Component, CEComponentTypeId TypeId );
+            void RegisterActorComponents ( CEActor * Actor );
+            void UnregisterActorComponents ( CEActor * Actor );
+            void CreateActorEntity ( CEActor * Actor );
+            void DestroyActorEntity ( CEActor * Actor );
+            void BindComponentEntity ( CEComponent * Component, CEEntity Entity );
+            void RegisterSystemTick ( CETickGroup Group );
+            void RecycleActor ( CEActor * Actor );
 
+            //       
+            static constexpr uint64 MIN_IDS_PER_ACTOR = 2;
+            static uint64 GetActorIDSpan ( const CEActor * Actor );
+            void ReusePooledActor ( CEActor * Actor );
+            void ReservePendingActors ( size_t Count );
+            void ReserveForSpawnBatch ();
             void ProcessPendingSpawns ();
             void ProcessPendingKills ();
         };
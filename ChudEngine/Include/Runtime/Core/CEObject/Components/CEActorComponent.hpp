@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/CEObject/CEObject.hpp"
+#include "Core/CEObject/CEClass.hpp"
 
 
 namespace CE
@@ -8,6 +9,8 @@ namespace CE
 
     class CEActorComponent : public CEObject
         {
+        DECLARE_CLASS ( CEActorComponent, CEObject )
+
         public:
             CEActorComponent ();
             virtual ~CEActorComponent ();
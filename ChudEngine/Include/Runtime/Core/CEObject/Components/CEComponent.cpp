@@ -5,7 +5,7 @@ namespace CE
     {
     CEComponent::CEComponent ()        
         {
-        Name = "CEComponent";
+        SetName ( "CEComponent" );
         CE_DEBUG ( "CEComponent '{}' created (ID: {})", Name, UniqueID );
         }
 
@@ -1,13 +1,38 @@
 #pragma once
 
 #include "Core/CEObject/CEObject.hpp"
+#include "Core/CEObject/CEClass.hpp"
+#include "Core/ECS/CEEntity.hpp"
+#include <atomic>
 
 namespace CE
     {
     class CEActor;
+    class CEEntityStorage;
+
+    // Dense per-type component ID, assigned on first use. Indexes the per-actor component table.
+    using CEComponentTypeId = uint32;
+
+    struct CEComponentTypeRegistry
+        {
+        static CEComponentTypeId AllocateTypeId () { return NextTypeId.fetch_add ( 1, std::memory_order_relaxed ); }
+        static uint32 GetTypeCount () { return NextTypeId.load ( std::memory_order_relaxed ); }
+
+        private:
+            static inline std::atomic<CEComponentTypeId> NextTypeId { 0 };
+        };
+
+    template<typename T>
+    CEComponentTypeId GetComponentTypeId ()
+        {
+        static const CEComponentTypeId TypeId = CEComponentTypeRegistry::AllocateTypeId ();
+        return TypeId;
+        }
 
     class CEComponent : public CEObject
         {
+        DECLARE_CLASS ( CEComponent, CEObject )
+
         public:
             CEComponent ();
             virtual ~CEComponent () = default;
@@ -25,7 +50,53 @@ namespace CE
             void SetActive ( bool bActive ) { bIsActive = bActive; }
 
         protected:
+            // Called by CEWorld when the owner gets or loses an entity in the world's entity storage;
+            // components mirror their hot data into it here
+            virtual void BindEntity ( CEEntityStorage & Storage, CEEntity Entity ) { }
+            virtual void UnbindEntity () { }
+
             CEActor * Owner = nullptr;
             bool bIsActive = true;
+
+        private:
+            friend class CEWorld;
+
+            // Position in the owning world's per-type component list
+            uint32 WorldRegistrySlot = UINT32_MAX;
+        };
+
+    // Non-owning view over a contiguous component list; casts on access and never allocates.
+    // Invalidated when components of that type are registered or unregistered.
+    template<typename T>
+    class CEComponentRange
+        {
+        public:
+            class Iterator
+                {
+                public:
+                    explicit Iterator ( CEComponent * const * InCurrent ) : Current ( InCurrent ) { }
+
+                    T * operator*() const { return static_cast< T * >( *Current ); }
+                    Iterator & operator++() { ++Current; return *this; }
+                    bool operator!=( const Iterator & Other ) const { return Current != Other.Current; }
+                    bool operator==( const Iterator & Other ) const { return Current == Other.Current; }
+
+                private:
+                    CEComponent * const * Current;
+                };
+
+            CEComponentRange () = default;
+            CEComponentRange ( CEComponent * const * InData, size_t InCount ) : Data ( InData ), Count ( InCount ) { }
+
+            Iterator begin () const { return Iterator ( Data ); }
+            Iterator end () const { return Iterator ( Data + Count ); }
+
+            size_t Size () const { return Count; }
+            bool IsEmpty () const { return Count == 0; }
+            T * operator[]( size_t Index ) const { return static_cast< T * >( Data[ Index ] ); }
+
+        private:
+            CEComponent * const * Data = nullptr;
+            size_t Count = 0;
         };
     }
\ No newline at end of file
@@ -40,6 +40,14 @@ namespace CE
         CE_DEBUG ( "CEMeshComponent '{}' created with {} vertices", GetName (), m_Vertices.size () );
         }
 
+    void CEMeshComponent::BindEntity ( CEEntityStorage & Storage, CEEntity Entity )
+        {
+            //     ,       
+        if (Storage.Has<CEMeshData> ( Entity )) return;
+
+        m_bDrawnFromEntity = Storage.Add<CEMeshData> ( Entity, CEMeshData { this } ) != nullptr;
+        }
+
     bool CEMeshComponent::EnsureBuffersCreated ( CEVulkanRenderer * renderer )
         {
         if (!renderer) return false;
@@ -1,5 +1,7 @@
 #pragma once
 #include "Core/CEObject/Components/CEComponent.hpp"
+#include "Core/ECS/CEEntityStorage.hpp"
+#include "Core/ECS/CEEntityData.hpp"
 #include "Graphics/Vulkan/CEVulkanBuffer.hpp"
 #include "Math/Vector.hpp"
 #include <memory>
@@ -15,6 +17,8 @@ namespace CE
 
     class CEMeshComponent : public CEComponent
         {
+        DECLARE_CLASS ( CEMeshComponent, CEComponent )
+
         public:
             CEMeshComponent ();
             virtual ~CEMeshComponent ();
@@ -70,15 +74,24 @@ namespace CE
             size_t GetIndexCount () const { return m_Indices.size (); }
             bool HasIndices () const { return !m_Indices.empty (); }
 
-            std::vector<Vertex> GetVertices () const { return m_Vertices; }
-            std::vector<uint32_t> GetIndices () const { return m_Indices; }
+            // By reference: the render path reads these every frame and must not copy them
+            const std::vector<Vertex> & GetVertices () const { return m_Vertices; }
+            const std::vector<uint32_t> & GetIndices () const { return m_Indices; }
             CEVulkanBuffer * GetIndexBuffer () const { return m_IndexBuffer.get (); }
 
+            // True when the renderer draws this mesh from the world's entity storage
+            bool IsDrawnFromEntity () const { return m_bDrawnFromEntity; }
+
+        protected:
+            virtual void BindEntity ( CEEntityStorage & Storage, CEEntity Entity ) override;
+            virtual void UnbindEntity () override { m_bDrawnFromEntity = false; }
+
         private:
             std::vector<Vertex> m_Vertices;
             std::vector<uint32_t> m_Indices;
             std::unique_ptr<CEVulkanBuffer> m_VertexBuffer;
             std::unique_ptr<CEVulkanBuffer> m_IndexBuffer;
             CEVulkanRenderer * m_Renderer = nullptr;
+            bool m_bDrawnFromEntity = false;
         };
     }
\ No newline at end of file
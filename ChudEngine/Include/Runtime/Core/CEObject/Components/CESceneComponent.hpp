@@ -9,6 +9,8 @@ namespace CE
     {
     class CESceneComponent : public CEActorComponent
         {
+        DECLARE_CLASS ( CESceneComponent, CEActorComponent )
+
         public:
             CESceneComponent ();
             virtual ~CESceneComponent ();
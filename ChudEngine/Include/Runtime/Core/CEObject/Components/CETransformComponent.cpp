@@ -1,4 +1,5 @@
 #include "Core/CEObject/Components/CETransformComponent.hpp"
+#include "Core/CEObject/CEActor.hpp"
 #include "Utils/Logger.hpp"
 #include "Math/MathUtils.hpp"
 #include "Math/Vector.hpp"
@@ -22,6 +23,11 @@ namespace CE
         }
 
     Math::Quaternion CETransformComponent::GetRotationQuaternion () const
+        {
+        return EulerToQuaternion ( GetData ().Rotation );
+        }
+
+    Math::Quaternion CETransformComponent::EulerToQuaternion ( const Math::Vector3 & Rotation )
         {
             // Convert Euler angles (degrees) to quaternion
         float pitch = Rotation.x * ( 3.14159f / 180.0f );
@@ -46,37 +52,42 @@ namespace CE
 
     void CETransformComponent::SetPosition ( const Math::Vector3 & NewPosition )
         {
-        Position = NewPosition;
+        CETransformData & data = GetData ();
+        data.Position = NewPosition;
         MarkDirty ();
         CE_DEBUG ( "Transform '{}' position set to ({}, {}, {})",
-                   GetName (), Position.x, Position.y, Position.z );
+                   GetName (), data.Position.x, data.Position.y, data.Position.z );
         }
 
     void CETransformComponent::SetRotation ( const Math::Vector3 & NewRotation )
         {
-        Rotation = NewRotation;
+        CETransformData & data = GetData ();
+        data.Rotation = NewRotation;
         MarkDirty ();
         CE_DEBUG ( "Transform '{}' rotation set to ({}, {}, {})",
-                   GetName (), Rotation.x, Rotation.y, Rotation.z );
+                   GetName (), data.Rotation.x, data.Rotation.y, data.Rotation.z );
         }
 
     void CETransformComponent::SetScale ( const Math::Vector3 & NewScale )
         {
-        Scale = NewScale;
+        CETransformData & data = GetData ();
+        data.Scale = NewScale;
         MarkDirty ();
         CE_DEBUG ( "Transform '{}' scale set to ({}, {}, {})",
-                   GetName (), Scale.x, Scale.y, Scale.z );
+                   GetName (), data.Scale.x, data.Scale.y, data.Scale.z );
         }
 
     void CETransformComponent::Translate ( const Math::Vector3 & Translation )
         {
-        Position = Position + Translation;
+        CETransformData & data = GetData ();
+        data.Position = data.Position + Translation;
         MarkDirty ();
         }
 
     void CETransformComponent::Rotate ( const Math::Vector3 & RotationDelta )
         {
-        Rotation = Rotation + RotationDelta;
+        CETransformData & data = GetData ();
+        data.Rotation = data.Rotation + RotationDelta;
         MarkDirty ();
         }
 
@@ -90,22 +101,24 @@ namespace CE
         float yaw = atan2 ( direction.x, direction.z );
         float pitch = asin ( -direction.y );
 
-        Rotation = Math::Vector3 ( pitch * ( 180.0f / 3.14159f ),
+        GetData ().Rotation = Math::Vector3 ( pitch * ( 180.0f / 3.14159f ),
                                    yaw * ( 180.0f / 3.14159f ),
                                    0.0f );
         MarkDirty ();
         }
 
     Math::Matrix4 CETransformComponent::GetLocalTransform () const {
-        if (bTransformDirty)
+            //     CETransformData ,     bDirty 
+        if (bTransformDirty || ( EntityStorage && GetData ().bDirty ))
             {
             UpdateTransform ();
 
             //  
+            const CETransformData & data = GetData ();
             CE_DEBUG ( "=== Local Transform Update ===" );
-            CE_DEBUG ( "Position: ({}, {}, {})", Position.x, Position.y, Position.z );
-            CE_DEBUG ( "Rotation: ({}, {}, {})", Rotation.x, Rotation.y, Rotation.z );
-            CE_DEBUG ( "Scale: ({}, {}, {})", Scale.x, Scale.y, Scale.z );
+            CE_DEBUG ( "Position: ({}, {}, {})", data.Position.x, data.Position.y, data.Position.z );
+            CE_DEBUG ( "Rotation: ({}, {}, {})", data.Rotation.x, data.Rotation.y, data.Rotation.z );
+            CE_DEBUG ( "Scale: ({}, {}, {})", data.Scale.x, data.Scale.y, data.Scale.z );
           
             CE_DEBUG ( "=============================" );
             }
@@ -146,6 +159,7 @@ namespace CE
 
             // Set new parent
         Parent = NewParent;
+        GetData ().bHasParent = Parent != nullptr;
 
         // Add to new parent
         if (Parent)
@@ -180,6 +194,7 @@ namespace CE
     void CETransformComponent::MarkDirty ()
         {
         bTransformDirty = true;
+        GetData ().bDirty = true;
         OnTransformChanged ();
 
         // Mark children as dirty too
@@ -197,19 +212,24 @@ namespace CE
             // Can be overridden by derived classes
         }
 
-    void CETransformComponent::UpdateTransform () const {
-        Math::Matrix4 translation = Math::Matrix4::Translation ( Position );
-        Math::Quaternion rotQuat = GetRotationQuaternion ();
-        Math::Matrix4 rotation = rotQuat.ToMatrix ();
-        Math::Matrix4 scale = Math::Matrix4::Scale ( Scale );
+    Math::Matrix4 CETransformComponent::ComposeLocalTransform ( const CETransformData & Data )
+        {
+        Math::Matrix4 translation = Math::Matrix4::Translation ( Data.Position );
+        Math::Matrix4 rotation = EulerToQuaternion ( Data.Rotation ).ToMatrix ();
+        Math::Matrix4 scale = Math::Matrix4::Scale ( Data.Scale );
 
         // :   - Translation * Rotation * Scale
-        CachedLocalTransform = translation * rotation * scale;
+        return translation * rotation * scale;
+        }
+
+    void CETransformComponent::UpdateTransform () const {
+        const CETransformData & data = GetData ();
+        CachedLocalTransform = ComposeLocalTransform ( data );
 
         //  
         CE_DEBUG ( "=== Transform Update: {} ===", GetName () );
-        CE_DEBUG ( "Position: ({:.1f}, {:.1f}, {:.1f})", Position.x, Position.y, Position.z );
-        CE_DEBUG ( "Scale: ({:.1f}, {:.1f}, {:.1f})", Scale.x, Scale.y, Scale.z );
+        CE_DEBUG ( "Position: ({:.1f}, {:.1f}, {:.1f})", data.Position.x, data.Position.y, data.Position.z );
+        CE_DEBUG ( "Scale: ({:.1f}, {:.1f}, {:.1f})", data.Scale.x, data.Scale.y, data.Scale.z );
 
         //  
         Math::Vector4 testPoint ( 0, 0, 0, 1 ); //  
@@ -239,4 +259,27 @@ namespace CE
             Children.erase ( it );
             }
         }
-    }
\ No newline at end of file
+
+    void CETransformComponent::BindEntity ( CEEntityStorage & Storage, CEEntity InEntity )
+        {
+            //      
+        CETransformData * data = Storage.Get<CETransformData> ( InEntity );
+        if (!data || !GetOwner () || GetOwner ()->GetTransform () != this) return;
+
+            //       
+        *data = LocalData;
+        data->bDirty = true;
+        EntityStorage = &Storage;
+        Entity = InEntity;
+        }
+
+    void CETransformComponent::UnbindEntity ()
+        {
+        if (!EntityStorage) return;
+
+        LocalData = GetData ();
+        EntityStorage = nullptr;
+        Entity = CEEntity ();
+        bTransformDirty = true;
+        }
+    }
@@ -3,19 +3,23 @@
 #include "Math/Vector.hpp"
 #include "Math/Matrix.hpp"
 #include "Math/Quaternion.hpp"
+#include "Core/ECS/CEEntityData.hpp"
+#include "Core/ECS/CEEntityStorage.hpp"
 
 namespace CE
     {
     class CETransformComponent : public CEComponent
         {
+        DECLARE_CLASS ( CETransformComponent, CEComponent )
+
         public:
             CETransformComponent ();
             virtual ~CETransformComponent () = default;
 
             // Transform properties
-            Math::Vector3 GetPosition () const { return Position; }
-            Math::Vector3 GetRotation () const { return Rotation; }
-            Math::Vector3 GetScale () const { return Scale; }
+            Math::Vector3 GetPosition () const { return GetData ().Position; }
+            Math::Vector3 GetRotation () const { return GetData ().Rotation; }
+            Math::Vector3 GetScale () const { return GetData ().Scale; }
             Math::Vector3 GetWorldPosition () const;
             Math::Quaternion GetRotationQuaternion () const;
 
@@ -47,13 +51,24 @@ namespace CE
             bool IsDirty () const { return bTransformDirty; }
             void MarkDirty ();
 
+            // Drops the cached local matrix; the entity transform update calls this when it consumes bDirty
+            void InvalidateCachedTransform () const { bTransformDirty = true; }
+
+            // Translation * Rotation * Scale, shared with the entity transform update
+            static Math::Matrix4 ComposeLocalTransform ( const CETransformData & Data );
+
+            // While bound, position/rotation/scale live in the world's entity storage
+            bool IsBoundToEntity () const { return EntityStorage != nullptr; }
+
         protected:
             virtual void OnTransformChanged ();
+            virtual void BindEntity ( CEEntityStorage & Storage, CEEntity InEntity ) override;
+            virtual void UnbindEntity () override;
 
         private:
-            Math::Vector3 Position = Math::Vector3 ( 0.0f, 0.0f, 0.0f );
-            Math::Vector3 Rotation = Math::Vector3 ( 0.0f, 0.0f, 0.0f ); // Euler angles in degrees
-            Math::Vector3 Scale = Math::Vector3 ( 1.0f, 1.0f, 1.0f );
+            CETransformData LocalData; // used while not bound to an entity
+            CEEntityStorage * EntityStorage = nullptr;
+            CEEntity Entity;
 
             // Hierarchy
             CETransformComponent * Parent = nullptr;
@@ -64,6 +79,10 @@ namespace CE
             mutable Math::Matrix4 CachedWorldTransform;
             mutable bool bTransformDirty = true;
 
+            CETransformData & GetData () { return EntityStorage ? *EntityStorage->Get<CETransformData> ( Entity ) : LocalData; }
+            const CETransformData & GetData () const { return EntityStorage ? *EntityStorage->Get<CETransformData> ( Entity ) : LocalData; }
+
+            static Math::Quaternion EulerToQuaternion ( const Math::Vector3 & Rotation );
             void UpdateTransform () const;
             void AddChild ( CETransformComponent * Child );
             void RemoveChild ( CETransformComponent * Child );
@@ -12,15 +12,39 @@
 
 namespace CE
     {
+        //  CEArray -      Allocate/Free.
+        //   malloc/free;    . CEFrameArrayAllocator
+    struct CEDefaultArrayAllocator
+        {
+        static void * Allocate ( size_t Bytes, size_t ) { return std::malloc ( Bytes ); }
+        static void Free ( void * Block, size_t, size_t ) { std::free ( Block ); }
+        };
+
+    //    InlineCapacity ;  0   
+    template<typename T, uint64 InlineCapacity>
+    struct CEArrayInlineStorage
+        {
+        T * GetInlineData () const { return reinterpret_cast< T * >( const_cast< unsigned char * >( InlineBuffer ) ); }
+
+        alignas( T ) unsigned char InlineBuffer[ InlineCapacity * sizeof ( T ) ];
+        };
+
     template<typename T>
-    class CEArray
+    struct CEArrayInlineStorage<T, 0>
+        {
+        T * GetInlineData () const { return nullptr; }
+        };
+
+    //  InlineCapacity     ,   -   
+    template<typename T, typename AllocatorType = CEDefaultArrayAllocator, uint64 InlineCapacity = 0>
+    class CEArray : private CEArrayInlineStorage<T, InlineCapacity>
         {
         public:
 
-            CEArray () : DataPtr ( nullptr ), ArraySize ( 0 ), ArrayCapacity ( 0 ) { }
+            CEArray () : DataPtr ( this->GetInlineData () ), ArraySize ( 0 ), ArrayCapacity ( InlineCapacity ) { }
 
             explicit CEArray ( uint64 initialCapacity )
-                : DataPtr ( nullptr ), ArraySize ( 0 ), ArrayCapacity ( 0 )
+                : DataPtr ( this->GetInlineData () ), ArraySize ( 0 ), ArrayCapacity ( InlineCapacity )
                 {
                 if (initialCapacity > 0)
                     Reserve ( initialCapacity );
@@ -29,17 +53,14 @@ namespace CE
             ~CEArray ()
                 {
                 Clear ();
-                if (DataPtr)
-                    std::free ( DataPtr );
+                ReleaseStorage ();
                 }
 
 
             CEArray ( CEArray && other ) noexcept
-                : DataPtr ( other.DataPtr ), ArraySize ( other.ArraySize ), ArrayCapacity ( other.ArrayCapacity )
+                : DataPtr ( this->GetInlineData () ), ArraySize ( 0 ), ArrayCapacity ( InlineCapacity )
                 {
-                other.DataPtr = nullptr;
-                other.ArraySize = 0;
-                other.ArrayCapacity = 0;
+                TakeElements ( other );
                 }
 
             CEArray & operator=( CEArray && other ) noexcept
@@ -47,47 +68,34 @@ namespace CE
                 if (this != &other)
                     {
                     Clear ();
-                    std::free ( DataPtr );
-
-                    DataPtr = other.DataPtr;
-                    ArraySize = other.ArraySize;
-                    ArrayCapacity = other.ArrayCapacity;
-
-                    other.DataPtr = nullptr;
-                    other.ArraySize = 0;
-                    other.ArrayCapacity = 0;
+                    ReleaseStorage ();
+                    TakeElements ( other );
                     }
                 return *this;
                 }
 
             CEArray ( std::initializer_list<T> initList )
-                : DataPtr ( nullptr ), ArraySize ( initList.size () ), ArrayCapacity ( initList.size () )
+                : DataPtr ( this->GetInlineData () ), ArraySize ( 0 ), ArrayCapacity ( InlineCapacity )
                 {
-                if (ArraySize > 0)
+                Reserve ( initList.size () );
+                for (const auto & item : initList)
                     {
-                    DataPtr = static_cast< T * >( std::malloc ( ArraySize * sizeof ( T ) ) );
-                    size_t i = 0;
-                    for (const auto & item : initList)
-                        {
-                        new( &DataPtr[ i ] ) T ( item );
-                        i++;
-                        }
+                    new( &DataPtr[ ArraySize ] ) T ( item );
+                    ++ArraySize;
                     }
                 }
 
                 //   C-
             template<size_t N>
             CEArray ( const T ( &array )[ N ] )
-                : DataPtr ( nullptr ), ArraySize ( N ), ArrayCapacity ( N )
+                : DataPtr ( this->GetInlineData () ), ArraySize ( 0 ), ArrayCapacity ( InlineCapacity )
                 {
-                if (ArraySize > 0)
+                Reserve ( N );
+                for (size_t i = 0; i < N; i++)
                     {
-                    DataPtr = static_cast< T * >( std::malloc ( ArraySize * sizeof ( T ) ) );
-                    for (size_t i = 0; i < ArraySize; i++)
-                        {
-                        new( &DataPtr[ i ] ) T ( array[ i ] );
-                        }
+                    new( &DataPtr[ i ] ) T ( array[ i ] );
                     }
+                ArraySize = N;
                 }
 
                 // Capacity
@@ -151,7 +159,7 @@ namespace CE
                 {
                 if (newCapacity <= ArrayCapacity) return;
 
-                T * newData = static_cast< T * >( std::malloc ( newCapacity * sizeof ( T ) ) );
+                T * newData = static_cast< T * >( AllocatorType::Allocate ( newCapacity * sizeof ( T ), alignof( T ) ) );
 
                 if (!newData) return;
 
@@ -162,7 +170,7 @@ namespace CE
                     DataPtr[ i ].~T ();
                     }
 
-                std::free ( DataPtr );
+                ReleaseStorage ();
                 DataPtr = newData;
                 ArrayCapacity = newCapacity;
                 }
@@ -235,13 +243,54 @@ namespace CE
             const T * begin () const { return DataPtr; }
             const T * end () const { return DataPtr + ArraySize; }
 
+            bool UsesInlineStorage () const { return InlineCapacity > 0 && DataPtr == this->GetInlineData (); }
+
         private:
             T * DataPtr = nullptr;
             uint64 ArraySize = 0;
             uint64 ArrayCapacity = 0;
 
+                //           (    )
+            void ReleaseStorage ()
+                {
+                if (DataPtr && !UsesInlineStorage ())
+                    {
+                    AllocatorType::Free ( DataPtr, ArrayCapacity * sizeof ( T ), alignof( T ) );
+                    }
+                DataPtr = this->GetInlineData ();
+                ArrayCapacity = InlineCapacity;
+                }
+
+                // this     .    ,     
+            void TakeElements ( CEArray & other )
+                {
+                if (other.UsesInlineStorage ())
+                    {
+                    for (uint64 i = 0; i < other.ArraySize; ++i)
+                        {
+                        new ( DataPtr + i ) T ( std::move ( other.DataPtr[ i ] ) );
+                        other.DataPtr[ i ].~T ();
+                        }
+                    ArraySize = other.ArraySize;
+                    other.ArraySize = 0;
+                    return;
+                    }
+
+                DataPtr = other.DataPtr;
+                ArraySize = other.ArraySize;
+                ArrayCapacity = other.ArrayCapacity;
+
+                other.DataPtr = other.GetInlineData ();
+                other.ArraySize = 0;
+                other.ArrayCapacity = InlineCapacity;
+                }
+
 
             CEArray ( const CEArray & ) = delete;
             CEArray & operator=( const CEArray & ) = delete;
         };
+
+    // CEArray,   N    (,   - )
+    template<typename T, uint64 N, typename AllocatorType = CEDefaultArrayAllocator>
+    using CEInlineArray = CEArray<T, AllocatorType, N>;
     }
\ No newline at end of file
@@ -25,7 +25,7 @@ namespace CE
 
     //  
     using FString = std::string;
-    using FName = std::string;
+    // FName -  , . Core/Name/CEName.hpp
 
     //  
     using Bool = bool;
@@ -44,4 +44,11 @@ namespace CE
 #define CE_CORE_ASSERT(condition, message) ((void)0)
 #endif
 #endif
+//     :    
+#if defined(_MSC_VER)
+#define CE_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define CE_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 #include "Utils/Logger.hpp"
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "Core/ECS/CEArchetype.hpp"
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace CE
+    {
+    namespace
+        {
+        uint32 AlignUp ( uint32 Value, uint32 Alignment )
+            {
+            return ( Value + Alignment - 1 ) & ~( Alignment - 1 );
+            }
+        }
+
+    CEArchetype::CEArchetype ( const CEDataComponentMask & InMask )
+        : Mask ( InMask )
+        {
+        std::memset ( ColumnLookup, NO_COLUMN, sizeof ( ColumnLookup ) );
+
+        uint32 rowBytes = sizeof ( CEEntity );
+        for (CEDataComponentId id = 0; id < MAX_DATA_COMPONENT_TYPES; ++id)
+            {
+            if (!Mask.test ( id )) continue;
+
+            const CEDataComponentInfo & info = CEDataComponentRegistry::GetInfo ( id );
+            ColumnLookup[ id ] = static_cast< uint8 >( Columns.size () );
+            Columns.push_back ( { id, 0, info.Size, &info } );
+            rowBytes += info.Size;
+            }
+
+            // Largest alignment first keeps the padding between columns small
+        std::vector<CEArchetypeColumn> ordered = Columns;
+        std::stable_sort ( ordered.begin (), ordered.end (), [] ( const CEArchetypeColumn & A, const CEArchetypeColumn & B )
+                           {
+                           return A.Info->Alignment > B.Info->Alignment;
+                           } );
+
+        // Pick the largest row count whose columns, with alignment padding, fit into a chunk
+        ChunkCapacity = std::max<uint32> ( 1, CHUNK_BYTES / rowBytes );
+        for (;; --ChunkCapacity)
+            {
+            uint32 offset = ChunkCapacity * static_cast< uint32 >( sizeof ( CEEntity ) );
+            for (CEArchetypeColumn & column : ordered)
+                {
+                offset = AlignUp ( offset, column.Info->Alignment );
+                column.Offset = offset;
+                offset += column.Size * ChunkCapacity;
+                }
+
+            if (offset <= CHUNK_BYTES || ChunkCapacity == 1)
+                {
+                ChunkBytes = std::max ( offset, CHUNK_BYTES );
+                break;
+                }
+            }
+
+        for (const CEArchetypeColumn & column : ordered)
+            {
+            Columns[ ColumnLookup[ column.Id ] ].Offset = column.Offset;
+            }
+        }
+
+    CEArchetype::~CEArchetype ()
+        {
+        while (EntityCount > 0)
+            {
+            RemoveRow ( EntityCount - 1, true );
+            }
+
+        for (unsigned char * chunk : Chunks)
+            {
+            ::operator delete( chunk, std::align_val_t ( CHUNK_ALIGNMENT ) );
+            }
+        }
+
+    void CEArchetype::Reserve ( uint32 Count )
+        {
+        uint32 chunksNeeded = ( Count + ChunkCapacity - 1 ) / ChunkCapacity;
+        Chunks.reserve ( chunksNeeded );
+        while (Chunks.size () < chunksNeeded)
+            {
+            Chunks.push_back ( static_cast< unsigned char * >( ::operator new( ChunkBytes, std::align_val_t ( CHUNK_ALIGNMENT ) ) ) );
+            }
+        }
+
+    uint32 CEArchetype::AddRow ( CEEntity Entity )
+        {
+        uint32 row = EntityCount;
+        Reserve ( row + 1 );
+
+        reinterpret_cast< CEEntity * >( Chunks[ row / ChunkCapacity ] )[ row % ChunkCapacity ] = Entity;
+        ++EntityCount;
+        return row;
+        }
+
+    CEEntity CEArchetype::RemoveRow ( uint32 Row, bool bDestroyComponents )
+        {
+        uint32 last = EntityCount - 1;
+
+        for (const CEArchetypeColumn & column : Columns)
+            {
+            void * target = GetComponent ( Row, column.Id );
+            if (bDestroyComponents && column.Info->Destroy)
+                {
+                column.Info->Destroy ( target );
+                }
+
+            if (Row != last)
+                {
+                void * source = GetComponent ( last, column.Id );
+                if (column.Info->Relocate)
+                    {
+                    column.Info->Relocate ( target, source );
+                    }
+                else
+                    {
+                    std::memcpy ( target, source, column.Size );
+                    }
+                }
+            }
+
+        CEEntity moved;
+        if (Row != last)
+            {
+            moved = GetEntity ( last );
+            reinterpret_cast< CEEntity * >( Chunks[ Row / ChunkCapacity ] )[ Row % ChunkCapacity ] = moved;
+            }
+        --EntityCount;
+
+        // Keep one spare chunk so an entity bouncing across a chunk boundary does not reallocate
+        while (Chunks.size () > GetChunkCount () + 1)
+            {
+            ::operator delete( Chunks.back (), std::align_val_t ( CHUNK_ALIGNMENT ) );
+            Chunks.pop_back ();
+            }
+        return moved;
+        }
+    }
@@ -0,0 +1,91 @@
+// Runtime/Core/ECS/CEArchetype.hpp
+#pragma once
+#include "Core/ECS/CEEntity.hpp"
+#include <vector>
+
+namespace CE
+    {
+    // Table of all entities that have exactly the same set of data components.
+    // Rows live in fixed-size chunks laid out as structure-of-arrays: the entity handles first,
+    // then one contiguous column per component. Every chunk but the last is full, and removal
+    // moves the last row into the hole, so iteration never skips over dead rows.
+    // A row larger than CHUNK_BYTES gets a chunk of its own, sized to fit it.
+    class CEArchetype
+        {
+        public:
+            static constexpr uint32 CHUNK_BYTES = 16 * 1024;
+            static constexpr uint32 CHUNK_ALIGNMENT = 64;
+            static constexpr uint8 NO_COLUMN = 0xFF;
+
+            explicit CEArchetype ( const CEDataComponentMask & InMask );
+            ~CEArchetype ();
+
+            CEArchetype ( const CEArchetype & ) = delete;
+            CEArchetype & operator=( const CEArchetype & ) = delete;
+
+            const CEDataComponentMask & GetMask () const { return Mask; }
+            bool HasComponent ( CEDataComponentId Id ) const { return ColumnLookup[ Id ] != NO_COLUMN; }
+
+            uint32 GetEntityCount () const { return EntityCount; }
+            uint32 GetChunkCapacity () const { return ChunkCapacity; }
+            uint32 GetChunkCount () const { return ( EntityCount + ChunkCapacity - 1 ) / ChunkCapacity; }
+            uint32 GetChunkEntityCount ( uint32 Chunk ) const
+                {
+                uint32 begin = Chunk * ChunkCapacity;
+                return EntityCount - begin < ChunkCapacity ? EntityCount - begin : ChunkCapacity;
+                }
+
+            // Columns of one chunk; valid until the next structural change of this archetype
+            const CEEntity * GetEntities ( uint32 Chunk ) const
+                {
+                return reinterpret_cast< const CEEntity * >( Chunks[ Chunk ] );
+                }
+
+            void * GetColumn ( uint32 Chunk, CEDataComponentId Id ) const
+                {
+                return Chunks[ Chunk ] + Columns[ ColumnLookup[ Id ] ].Offset;
+                }
+
+            template<typename T>
+            T * GetColumn ( uint32 Chunk ) const
+                {
+                return static_cast< T * >( GetColumn ( Chunk, GetDataComponentId<T> () ) );
+                }
+
+            void * GetComponent ( uint32 Row, CEDataComponentId Id ) const
+                {
+                const CEArchetypeColumn & column = Columns[ ColumnLookup[ Id ] ];
+                return Chunks[ Row / ChunkCapacity ] + column.Offset + static_cast< size_t >( Row % ChunkCapacity ) * column.Size;
+                }
+
+            CEEntity GetEntity ( uint32 Row ) const { return GetEntities ( Row / ChunkCapacity )[ Row % ChunkCapacity ]; }
+
+        private:
+            friend class CEEntityStorage;
+
+            struct CEArchetypeColumn
+                {
+                CEDataComponentId Id;
+                uint32 Offset;
+                uint32 Size;
+                const CEDataComponentInfo * Info;
+                };
+
+            // Appends a row for Entity; component storage is left unconstructed for the caller
+            uint32 AddRow ( CEEntity Entity );
+
+            // Destroys the components of Row (unless they were already relocated), then moves
+            // the last row into it. Returns the entity now occupying Row, or an invalid handle.
+            CEEntity RemoveRow ( uint32 Row, bool bDestroyComponents );
+
+            void Reserve ( uint32 Count );
+
+            CEDataComponentMask Mask;
+            std::vector<CEArchetypeColumn> Columns;
+            uint8 ColumnLookup[ MAX_DATA_COMPONENT_TYPES ];
+            std::vector<unsigned char *> Chunks;
+            uint32 ChunkCapacity = 0;
+            uint32 ChunkBytes = CHUNK_BYTES; // CHUNK_BYTES, or one oversized row
+            uint32 EntityCount = 0;
+        };
+    }
@@ -0,0 +1,51 @@
+#include "Core/ECS/CEEntity.hpp"
+#include "Utils/Logger.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+namespace CE
+    {
+    namespace
+        {
+        struct CEDataComponentTable
+            {
+            std::mutex Mutex;
+            CEDataComponentInfo Infos[ MAX_DATA_COMPONENT_TYPES ];
+            std::atomic<uint32> Count { 0 };
+            };
+
+        CEDataComponentTable & GetDataComponentTable ()
+            {
+            static CEDataComponentTable Table;
+            return Table;
+            }
+        }
+
+    CEDataComponentId CEDataComponentRegistry::Register ( const CEDataComponentInfo & Info )
+        {
+        CEDataComponentTable & table = GetDataComponentTable ();
+        std::lock_guard<std::mutex> lock ( table.Mutex );
+
+        uint32 id = table.Count.load ( std::memory_order_relaxed );
+        if (id >= MAX_DATA_COMPONENT_TYPES)
+            {
+            CE_CORE_CRITICAL ( "Too many data component types (limit {})", MAX_DATA_COMPONENT_TYPES );
+            std::abort ();
+            }
+
+        table.Infos[ id ] = Info;
+        table.Count.store ( id + 1, std::memory_order_release );
+        return id;
+        }
+
+    const CEDataComponentInfo & CEDataComponentRegistry::GetInfo ( CEDataComponentId Id )
+        {
+        return GetDataComponentTable ().Infos[ Id ];
+        }
+
+    uint32 CEDataComponentRegistry::GetTypeCount ()
+        {
+        return GetDataComponentTable ().Count.load ( std::memory_order_acquire );
+        }
+    }
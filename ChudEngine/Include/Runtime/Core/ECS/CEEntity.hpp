@@ -0,0 +1,91 @@
+// Runtime/Core/ECS/CEEntity.hpp
+#pragma once
+#include "Core/CoreTypes.hpp"
+#include <bitset>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CE
+    {
+        // Handle to an entity in a CEEntityStorage; the generation detects reuse of a destroyed slot
+    struct CEEntity
+        {
+        uint32 Index = UINT32_MAX;
+        uint32 Generation = 0;
+
+        bool IsValid () const { return Index != UINT32_MAX; }
+        bool operator==( const CEEntity & Other ) const { return Index == Other.Index && Generation == Other.Generation; }
+        bool operator!=( const CEEntity & Other ) const { return !( *this == Other ); }
+        };
+
+    // Data components are plain structs stored by value in archetype chunks.
+    // They get their own dense IDs, separate from the CEComponent type IDs of the actor facade.
+    using CEDataComponentId = uint32;
+
+    static constexpr uint32 MAX_DATA_COMPONENT_TYPES = 128;
+    using CEDataComponentMask = std::bitset<MAX_DATA_COMPONENT_TYPES>;
+
+    struct CEDataComponentInfo
+        {
+        uint32 Size = 0;
+        uint32 Alignment = 1;
+
+            // Both null for trivially copyable types (relocated with memcpy)
+        void ( *Relocate )( void * Destination, void * Source ) = nullptr; // move-construct, then destroy Source
+        void ( *Destroy )( void * Object ) = nullptr;
+        };
+
+    class CEDataComponentRegistry
+        {
+        public:
+            template<typename T>
+            static CEDataComponentId GetId ()
+                {
+                static_assert( std::is_same_v<T, std::remove_cv_t<T>>, "Use the unqualified data component type" );
+                static const CEDataComponentId Id = Register ( MakeInfo<T> () );
+                return Id;
+                }
+
+            static const CEDataComponentInfo & GetInfo ( CEDataComponentId Id );
+            static uint32 GetTypeCount ();
+
+        private:
+            static CEDataComponentId Register ( const CEDataComponentInfo & Info );
+
+            template<typename T>
+            static CEDataComponentInfo MakeInfo ()
+                {
+                static_assert( std::is_move_constructible_v<T>, "Data components must be movable" );
+                static_assert( alignof( T ) <= 64, "Data components are limited to cache line alignment" );
+
+                CEDataComponentInfo info;
+                info.Size = static_cast< uint32 >( sizeof ( T ) );
+                info.Alignment = static_cast< uint32 >( alignof( T ) );
+                if constexpr (!std::is_trivially_copyable_v<T>)
+                    {
+                    info.Relocate = [] ( void * Destination, void * Source )
+                        {
+                        new ( Destination ) T ( std::move ( *static_cast< T * >( Source ) ) );
+                        static_cast< T * >( Source )->~T ();
+                        };
+                    info.Destroy = [] ( void * Object ) { static_cast< T * >( Object )->~T (); };
+                    }
+                return info;
+                }
+        };
+
+    template<typename T>
+    inline CEDataComponentId GetDataComponentId ()
+        {
+        return CEDataComponentRegistry::GetId<std::remove_cv_t<T>> ();
+        }
+
+    template<typename... Ts>
+    inline CEDataComponentMask MakeDataComponentMask ()
+        {
+        CEDataComponentMask mask;
+        ( mask.set ( GetDataComponentId<Ts> () ), ... );
+        return mask;
+        }
+    }
@@ -0,0 +1,39 @@
+// Runtime/Core/ECS/CEEntityData.hpp
+#pragma once
+#include "Core/ECS/CEEntity.hpp"
+#include "Math/Vector.hpp"
+#include "Math/Matrix.hpp"
+
+namespace CE
+    {
+    class CEActor;
+    class CEMeshComponent;
+
+    // Data components the actor facade mirrors into CEWorld's entity storage.
+    // Systems that write CETransformData directly must set bDirty; parent links are
+    // only followed through the component facade.
+
+    struct CEActorData
+        {
+        CEActor * Actor = nullptr;
+        };
+
+    struct CETransformData
+        {
+        Math::Vector3 Position = Math::Vector3 ( 0.0f, 0.0f, 0.0f );
+        Math::Vector3 Rotation = Math::Vector3 ( 0.0f, 0.0f, 0.0f ); // Euler angles in degrees
+        Math::Vector3 Scale = Math::Vector3 ( 1.0f, 1.0f, 1.0f );
+        bool bDirty = true;
+        bool bHasParent = false;
+        };
+
+    struct CEWorldTransformData
+        {
+        Math::Matrix4 Matrix = Math::Matrix4 ( 1.0f );
+        };
+
+    struct CEMeshData
+        {
+        CEMeshComponent * Mesh = nullptr;
+        };
+    }
@@ -0,0 +1,149 @@
+#include "Core/ECS/CEEntityStorage.hpp"
+#include <cstring>
+
+namespace CE
+    {
+    void CEEntityStorage::DestroyEntity ( CEEntity Entity )
+        {
+        if (!IsAlive ( Entity )) return;
+
+        CEEntitySlot & slot = Slots[ Entity.Index ];
+        RemoveRow ( slot.Archetype, slot.Row, true );
+
+        slot.Archetype = nullptr;
+        ++slot.Generation;
+        FreeSlots.push_back ( Entity.Index );
+        --AliveCount;
+        }
+
+    void CEEntityStorage::ReserveEntities ( uint32 Count )
+        {
+        uint32 freeCount = static_cast< uint32 >( FreeSlots.size () );
+        if (Count > freeCount)
+            {
+            Slots.reserve ( Slots.size () + ( Count - freeCount ) );
+            }
+        }
+
+    CEArchetype * CEEntityStorage::FindOrCreateArchetype ( const CEDataComponentMask & Mask )
+        {
+        auto it = ArchetypesByMask.find ( Mask );
+        if (it != ArchetypesByMask.end ()) return it->second;
+
+        CEArchetype * archetype = Archetypes.emplace_back ( std::make_unique<CEArchetype> ( Mask ) ).get ();
+        ArchetypesByMask.emplace ( Mask, archetype );
+
+        for (auto & [queryMask, matches] : QueryCache)
+            {
+            if (( Mask & queryMask ) == queryMask)
+                {
+                matches.push_back ( archetype );
+                }
+            }
+        return archetype;
+        }
+
+    const std::vector<CEArchetype *> & CEEntityStorage::GetMatchingArchetypes ( const CEDataComponentMask & Mask )
+        {
+        auto [it, bInserted] = QueryCache.try_emplace ( Mask );
+        if (bInserted)
+            {
+            for (const auto & archetype : Archetypes)
+                {
+                if (( archetype->GetMask () & Mask ) == Mask)
+                    {
+                    it->second.push_back ( archetype.get () );
+                    }
+                }
+            }
+        return it->second;
+        }
+
+    CEEntity CEEntityStorage::AllocateEntity ( CEArchetype * Archetype, uint32 & OutRow )
+        {
+        CEEntity entity;
+        if (!FreeSlots.empty ())
+            {
+            entity.Index = FreeSlots.back ();
+            FreeSlots.pop_back ();
+            }
+        else
+            {
+            entity.Index = static_cast< uint32 >( Slots.size () );
+            Slots.emplace_back ();
+            }
+
+        CEEntitySlot & slot = Slots[ entity.Index ];
+        entity.Generation = slot.Generation;
+        OutRow = Archetype->AddRow ( entity );
+        slot.Archetype = Archetype;
+        slot.Row = OutRow;
+        ++AliveCount;
+        return entity;
+        }
+
+    void CEEntityStorage::RemoveRow ( CEArchetype * Archetype, uint32 Row, bool bDestroyComponents )
+        {
+        CEEntity moved = Archetype->RemoveRow ( Row, bDestroyComponents );
+        if (moved.IsValid ())
+            {
+            Slots[ moved.Index ].Row = Row;
+            }
+        }
+
+    void CEEntityStorage::MoveToArchetype ( CEEntity Entity, CEArchetype * Target )
+        {
+        CEEntitySlot & slot = Slots[ Entity.Index ];
+        CEArchetype * source = slot.Archetype;
+        uint32 sourceRow = slot.Row;
+        uint32 targetRow = Target->AddRow ( Entity );
+
+        // Relocate shared components, destroy the ones the target does not have
+        for (const CEArchetype::CEArchetypeColumn & column : source->Columns)
+            {
+            void * from = source->GetComponent ( sourceRow, column.Id );
+            if (Target->HasComponent ( column.Id ))
+                {
+                void * to = Target->GetComponent ( targetRow, column.Id );
+                if (column.Info->Relocate)
+                    {
+                    column.Info->Relocate ( to, from );
+                    }
+                else
+                    {
+                    std::memcpy ( to, from, column.Size );
+                    }
+                }
+            else if (column.Info->Destroy)
+                {
+                column.Info->Destroy ( from );
+                }
+            }
+
+        RemoveRow ( source, sourceRow, false );
+        slot.Archetype = Target;
+        slot.Row = targetRow;
+        }
+
+    void * CEEntityStorage::AddComponentStorage ( CEEntity Entity, CEDataComponentId Id )
+        {
+        if (!IsAlive ( Entity )) return nullptr;
+
+        CEDataComponentMask mask = Slots[ Entity.Index ].Archetype->GetMask ();
+        mask.set ( Id );
+        CEArchetype * target = FindOrCreateArchetype ( mask );
+        MoveToArchetype ( Entity, target );
+
+        const CEEntitySlot & slot = Slots[ Entity.Index ];
+        return target->GetComponent ( slot.Row, Id );
+        }
+
+    void CEEntityStorage::RemoveComponent ( CEEntity Entity, CEDataComponentId Id )
+        {
+        if (!IsAlive ( Entity ) || !Slots[ Entity.Index ].Archetype->HasComponent ( Id )) return;
+
+        CEDataComponentMask mask = Slots[ Entity.Index ].Archetype->GetMask ();
+        mask.reset ( Id );
+        MoveToArchetype ( Entity, FindOrCreateArchetype ( mask ) );
+        }
+    }
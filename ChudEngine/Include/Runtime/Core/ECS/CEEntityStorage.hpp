@@ -0,0 +1,184 @@
+// Runtime/Core/ECS/CEEntityStorage.hpp
+#pragma once
+#include "Core/ECS/CEArchetype.hpp"
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CE
+    {
+    // View over every archetype that has at least the components Ts.
+    // A const T in Ts hands out const references. Adding or removing entities or components
+    // while iterating is not allowed; collect the changes and apply them afterwards.
+    template<typename... Ts>
+    class CEEntityQuery
+        {
+        public:
+            explicit CEEntityQuery ( const std::vector<CEArchetype *> * InArchetypes ) : Archetypes ( InArchetypes ) { }
+
+            // Function ( uint32 Count, const CEEntity * Entities, Ts *... Columns ) once per chunk
+            template<typename FunctionType>
+            void ForEachChunk ( FunctionType && Function ) const
+                {
+                for (CEArchetype * archetype : *Archetypes)
+                    {
+                    uint32 chunkCount = archetype->GetChunkCount ();
+                    for (uint32 chunk = 0; chunk < chunkCount; ++chunk)
+                        {
+                        Function ( archetype->GetChunkEntityCount ( chunk ), archetype->GetEntities ( chunk ),
+                                   archetype->template GetColumn<std::remove_const_t<Ts>> ( chunk )... );
+                        }
+                    }
+                }
+
+            // Function ( Ts &... ) once per entity
+            template<typename FunctionType>
+            void ForEach ( FunctionType && Function ) const
+                {
+                ForEachChunk ( [ &Function ] ( uint32 Count, const CEEntity *, Ts *... Columns )
+                               {
+                               for (uint32 i = 0; i < Count; ++i)
+                                   {
+                                   Function ( Columns[ i ]... );
+                                   }
+                               } );
+                }
+
+            // Function ( CEEntity, Ts &... ) once per entity
+            template<typename FunctionType>
+            void ForEachWithEntity ( FunctionType && Function ) const
+                {
+                ForEachChunk ( [ &Function ] ( uint32 Count, const CEEntity * Entities, Ts *... Columns )
+                               {
+                               for (uint32 i = 0; i < Count; ++i)
+                                   {
+                                   Function ( Entities[ i ], Columns[ i ]... );
+                                   }
+                               } );
+                }
+
+            uint32 GetEntityCount () const
+                {
+                uint32 count = 0;
+                for (CEArchetype * archetype : *Archetypes)
+                    {
+                    count += archetype->GetEntityCount ();
+                    }
+                return count;
+                }
+
+            const std::vector<CEArchetype *> & GetArchetypes () const { return *Archetypes; }
+
+        private:
+            const std::vector<CEArchetype *> * Archetypes;
+        };
+
+    // Data-oriented entity storage: entities are grouped by component set into archetype tables,
+    // so a query walks contiguous columns instead of chasing object pointers.
+    // Structural changes (create, destroy, add, remove) are game thread only.
+    class CEEntityStorage
+        {
+        public:
+            CEEntityStorage () = default;
+            ~CEEntityStorage () = default;
+
+            CEEntityStorage ( const CEEntityStorage & ) = delete;
+            CEEntityStorage & operator=( const CEEntityStorage & ) = delete;
+
+            template<typename... Ts>
+            CEEntity CreateEntity ( Ts &&... Components )
+                {
+                CEArchetype * archetype = FindOrCreateArchetype ( MakeDataComponentMask<std::decay_t<Ts>...> () );
+                uint32 row = 0;
+                CEEntity entity = AllocateEntity ( archetype, row );
+                ( new ( archetype->GetComponent ( row, GetDataComponentId<std::decay_t<Ts>> () ) )
+                  std::decay_t<Ts> ( std::forward<Ts> ( Components ) ), ... );
+                return entity;
+                }
+
+            void DestroyEntity ( CEEntity Entity );
+
+            // Grows the slot table for Count more entities ahead of a bulk create
+            void ReserveEntities ( uint32 Count );
+
+            bool IsAlive ( CEEntity Entity ) const
+                {
+                return Entity.Index < Slots.size () && Slots[ Entity.Index ].Archetype
+                    && Slots[ Entity.Index ].Generation == Entity.Generation;
+                }
+
+            template<typename T>
+            T * Get ( CEEntity Entity ) const
+                {
+                if (!IsAlive ( Entity )) return nullptr;
+
+                const CEEntitySlot & slot = Slots[ Entity.Index ];
+                CEDataComponentId id = GetDataComponentId<T> ();
+                if (!slot.Archetype->HasComponent ( id )) return nullptr;
+                return static_cast< T * >( slot.Archetype->GetComponent ( slot.Row, id ) );
+                }
+
+            template<typename T>
+            bool Has ( CEEntity Entity ) const
+                {
+                return IsAlive ( Entity ) && Slots[ Entity.Index ].Archetype->HasComponent ( GetDataComponentId<T> () );
+                }
+
+            // Moves the entity to the archetype with T added; assigns if T is already there
+            template<typename T, typename... ArgTypes>
+            T * Add ( CEEntity Entity, ArgTypes &&... Args )
+                {
+                if (T * existing = Get<T> ( Entity ))
+                    {
+                    *existing = T ( std::forward<ArgTypes> ( Args )... );
+                    return existing;
+                    }
+
+                void * storage = AddComponentStorage ( Entity, GetDataComponentId<T> () );
+                return storage ? new ( storage ) T ( std::forward<ArgTypes> ( Args )... ) : nullptr;
+                }
+
+            template<typename T>
+            void Remove ( CEEntity Entity )
+                {
+                RemoveComponent ( Entity, GetDataComponentId<T> () );
+                }
+
+            template<typename... Ts>
+            CEEntityQuery<Ts...> Query ()
+                {
+                return CEEntityQuery<Ts...> ( &GetMatchingArchetypes ( MakeDataComponentMask<Ts...> () ) );
+                }
+
+            uint32 GetEntityCount () const { return AliveCount; }
+            size_t GetArchetypeCount () const { return Archetypes.size (); }
+
+        private:
+            struct CEEntitySlot
+                {
+                CEArchetype * Archetype = nullptr;
+                uint32 Row = 0;
+                uint32 Generation = 0;
+                };
+
+            std::vector<CEEntitySlot> Slots;
+            std::vector<uint32> FreeSlots;
+            uint32 AliveCount = 0;
+
+            std::vector<std::unique_ptr<CEArchetype>> Archetypes;
+            std::unordered_map<CEDataComponentMask, CEArchetype *> ArchetypesByMask;
+
+            // Matching archetypes per query mask; new archetypes are appended as they appear
+            std::unordered_map<CEDataComponentMask, std::vector<CEArchetype *>> QueryCache;
+
+            CEArchetype * FindOrCreateArchetype ( const CEDataComponentMask & Mask );
+            const std::vector<CEArchetype *> & GetMatchingArchetypes ( const CEDataComponentMask & Mask );
+            CEEntity AllocateEntity ( CEArchetype * Archetype, uint32 & OutRow );
+            void RemoveRow ( CEArchetype * Archetype, uint32 Row, bool bDestroyComponents );
+            void MoveToArchetype ( CEEntity Entity, CEArchetype * Target );
+            void * AddComponentStorage ( CEEntity Entity, CEDataComponentId Id );
+            void RemoveComponent ( CEEntity Entity, CEDataComponentId Id );
+        };
+    }
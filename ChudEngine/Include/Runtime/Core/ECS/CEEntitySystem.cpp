@@ -0,0 +1,116 @@
+#include "Core/ECS/CEEntitySystem.hpp"
+#include "Core/Jobs/CEJobSystem.hpp"
+#include <algorithm>
+
+namespace CE
+    {
+    void CEEntitySystemScheduler::RegisterSystem ( std::unique_ptr<CEEntitySystemBase> System )
+        {
+        CESystemGroup & group = Groups[ static_cast< int >( System->GetTickGroup () ) ];
+        group.Systems.push_back ( System.get () );
+        group.bWavesDirty = true;
+
+        CE_DEBUG ( "EntitySystemScheduler: added system '{}'", System->GetName () );
+        Systems.push_back ( std::move ( System ) );
+        }
+
+    void CEEntitySystemScheduler::RemoveSystem ( CEEntitySystemBase * System )
+        {
+        if (!System) return;
+
+        CESystemGroup & group = Groups[ static_cast< int >( System->GetTickGroup () ) ];
+        group.Systems.erase ( std::remove ( group.Systems.begin (), group.Systems.end (), System ), group.Systems.end () );
+        group.bWavesDirty = true;
+
+        Systems.erase ( std::remove_if ( Systems.begin (), Systems.end (),
+                                         [ System ] ( const std::unique_ptr<CEEntitySystemBase> & Entry ) { return Entry.get () == System; } ),
+                        Systems.end () );
+        }
+
+    uint32 CEEntitySystemScheduler::GetWaveCount ( CETickGroup Group )
+        {
+        CESystemGroup & group = Groups[ static_cast< int >( Group ) ];
+        if (group.bWavesDirty)
+            {
+            RebuildWaves ( group );
+            }
+        return static_cast< uint32 >( group.Waves.size () );
+        }
+
+    void CEEntitySystemScheduler::RebuildWaves ( CESystemGroup & Group )
+        {
+        Group.Waves.clear ();
+
+        // Each system goes one wave after the latest earlier system it conflicts with
+        std::vector<uint32> systemWaves ( Group.Systems.size (), 0 );
+        for (size_t i = 0; i < Group.Systems.size (); ++i)
+            {
+            uint32 wave = 0;
+            for (size_t j = 0; j < i; ++j)
+                {
+                if (Group.Systems[ i ]->ConflictsWith ( *Group.Systems[ j ] ))
+                    {
+                    wave = std::max ( wave, systemWaves[ j ] + 1 );
+                    }
+                }
+
+            systemWaves[ i ] = wave;
+            if (wave >= Group.Waves.size ())
+                {
+                Group.Waves.resize ( wave + 1 );
+                }
+            Group.Waves[ wave ].push_back ( Group.Systems[ i ] );
+            }
+
+        Group.bWavesDirty = false;
+        }
+
+    void CEEntitySystemScheduler::RunGroup ( CETickGroup Group, float DeltaTime )
+        {
+        CESystemGroup & group = Groups[ static_cast< int >( Group ) ];
+        if (group.bWavesDirty)
+            {
+            RebuildWaves ( group );
+            }
+
+        CurrentDeltaTime = DeltaTime;
+        for (const std::vector<CEEntitySystemBase *> & wave : group.Waves)
+            {
+            WorkItems.clear ();
+            for (CEEntitySystemBase * system : wave)
+                {
+                if (!system->IsEnabled ()) continue;
+
+                for (CEArchetype * archetype : system->ResolveArchetypes ( Storage ))
+                    {
+                    uint32 chunkCount = archetype->GetChunkCount ();
+                    for (uint32 chunk = 0; chunk < chunkCount; ++chunk)
+                        {
+                        WorkItems.push_back ( { system, archetype, chunk } );
+                        }
+                    }
+                }
+
+            uint32 itemCount = static_cast< uint32 >( WorkItems.size () );
+            if (itemCount < MIN_PARALLEL_CHUNKS || !CEJobSystem::IsInitialized ())
+                {
+                ExecuteWorkItems ( this, 0, itemCount );
+                continue;
+                }
+
+            CEJobCounter counter;
+            CEJobSystem::Dispatch ( itemCount, 1, &CEEntitySystemScheduler::ExecuteWorkItems, this, counter );
+            CEJobSystem::Wait ( counter );
+            }
+        }
+
+    void CEEntitySystemScheduler::ExecuteWorkItems ( void * Context, uint32 Begin, uint32 End )
+        {
+        CEEntitySystemScheduler & scheduler = *static_cast< CEEntitySystemScheduler * >( Context );
+        for (uint32 i = Begin; i < End; ++i)
+            {
+            const CESystemWorkItem & item = scheduler.WorkItems[ i ];
+            item.System->ExecuteChunk ( *item.Archetype, item.Chunk, scheduler.CurrentDeltaTime );
+            }
+        }
+    }
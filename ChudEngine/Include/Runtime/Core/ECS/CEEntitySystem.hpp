@@ -0,0 +1,186 @@
+// Runtime/Core/ECS/CEEntitySystem.hpp
+#pragma once
+#include "Core/ECS/CEEntityStorage.hpp"
+#include "Core/CEObject/CETickManager.hpp"
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CE
+    {
+        // Access declarations for CEEntitySystem: the read and write sets are part of the system's type
+    template<typename T>
+    struct CERead
+        {
+        using ComponentType = T;
+        using AccessType = const T;
+        static constexpr bool bWrite = false;
+        };
+
+    template<typename T>
+    struct CEWrite
+        {
+        using ComponentType = T;
+        using AccessType = T;
+        static constexpr bool bWrite = true;
+        };
+
+    // Type-erased part of a system, used by the scheduler
+    class CEEntitySystemBase
+        {
+        public:
+            CEEntitySystemBase ( const std::string & InName, CETickGroup InGroup ) : Name ( InName ), TickGroup ( InGroup ) { }
+            virtual ~CEEntitySystemBase () = default;
+
+            const std::string & GetName () const { return Name; }
+            CETickGroup GetTickGroup () const { return TickGroup; }
+
+            bool IsEnabled () const { return bEnabled; }
+            void SetEnabled ( bool bEnable ) { bEnabled = bEnable; }
+
+            const CEDataComponentMask & GetReadMask () const { return ReadMask; }
+            const CEDataComponentMask & GetWriteMask () const { return WriteMask; }
+
+            // Two systems may run at the same time unless one writes what the other touches
+            bool ConflictsWith ( const CEEntitySystemBase & Other ) const
+                {
+                return ( WriteMask & ( Other.ReadMask | Other.WriteMask ) ).any () || ( Other.WriteMask & ReadMask ).any ();
+                }
+
+        protected:
+            CEDataComponentMask ReadMask;
+            CEDataComponentMask WriteMask;
+
+        private:
+            friend class CEEntitySystemScheduler;
+
+            // Archetypes that have every accessed component (the list is owned by the storage)
+            virtual const std::vector<CEArchetype *> & ResolveArchetypes ( CEEntityStorage & Storage ) = 0;
+
+            // Called from worker threads, one chunk at a time
+            virtual void ExecuteChunk ( CEArchetype & Archetype, uint32 Chunk, float DeltaTime ) = 0;
+
+            std::string Name;
+            CETickGroup TickGroup;
+            bool bEnabled = true;
+        };
+
+    // Base for typed systems: CEEntitySystem<CERead<CETransformData>, CEWrite<Velocity>>.
+    // UpdateChunk receives one column per access, in declaration order, const for CERead.
+    // It may run on any worker thread and must not create or destroy entities or components.
+    template<typename... Accesses>
+    class CEEntitySystem : public CEEntitySystemBase
+        {
+        public:
+            CEEntitySystem ( const std::string & InName, CETickGroup InGroup )
+                : CEEntitySystemBase ( InName, InGroup )
+                {
+                ( ( Accesses::bWrite ? WriteMask : ReadMask ).set ( GetDataComponentId<typename Accesses::ComponentType> () ), ... );
+                }
+
+        protected:
+            virtual void UpdateChunk ( float DeltaTime, uint32 Count, typename Accesses::AccessType *... Columns ) = 0;
+
+        private:
+            const std::vector<CEArchetype *> & ResolveArchetypes ( CEEntityStorage & Storage ) override
+                {
+                return Storage.Query<typename Accesses::AccessType...> ().GetArchetypes ();
+                }
+
+            void ExecuteChunk ( CEArchetype & Archetype, uint32 Chunk, float DeltaTime ) override
+                {
+                UpdateChunk ( DeltaTime, Archetype.GetChunkEntityCount ( Chunk ),
+                              Archetype.template GetColumn<typename Accesses::ComponentType> ( Chunk )... );
+                }
+        };
+
+    // System built from a callable invoked per entity: Function ( float DeltaTime, Accesses::AccessType &... )
+    template<typename FunctionType, typename... Accesses>
+    class CEFunctionEntitySystem final : public CEEntitySystem<Accesses...>
+        {
+        public:
+            CEFunctionEntitySystem ( const std::string & InName, CETickGroup InGroup, FunctionType && InFunction )
+                : CEEntitySystem<Accesses...> ( InName, InGroup ), Function ( std::move ( InFunction ) ) { }
+
+        protected:
+            void UpdateChunk ( float DeltaTime, uint32 Count, typename Accesses::AccessType *... Columns ) override
+                {
+                for (uint32 i = 0; i < Count; ++i)
+                    {
+                    Function ( DeltaTime, Columns[ i ]... );
+                    }
+                }
+
+        private:
+            FunctionType Function;
+        };
+
+    // Orders the systems of each tick group into waves: systems in one wave have no conflicting
+    // accesses and run concurrently, chunk by chunk, on the job system. A system always runs after
+    // every earlier-registered system it conflicts with.
+    class CEEntitySystemScheduler
+        {
+        public:
+            explicit CEEntitySystemScheduler ( CEEntityStorage & InStorage ) : Storage ( InStorage ) { }
+
+            CEEntitySystemScheduler ( const CEEntitySystemScheduler & ) = delete;
+            CEEntitySystemScheduler & operator=( const CEEntitySystemScheduler & ) = delete;
+
+            template<typename SystemType, typename... ArgTypes>
+            SystemType * AddSystem ( ArgTypes &&... Args )
+                {
+                static_assert( std::is_base_of_v<CEEntitySystemBase, SystemType>, "SystemType must derive from CEEntitySystem" );
+
+                auto system = std::make_unique<SystemType> ( std::forward<ArgTypes> ( Args )... );
+                SystemType * rawPtr = system.get ();
+                RegisterSystem ( std::move ( system ) );
+                return rawPtr;
+                }
+
+            template<typename... Accesses, typename FunctionType>
+            CEEntitySystemBase * AddSystemFunction ( const std::string & Name, CETickGroup Group, FunctionType && Function )
+                {
+                using SystemType = CEFunctionEntitySystem<std::decay_t<FunctionType>, Accesses...>;
+                return AddSystem<SystemType> ( Name, Group, std::decay_t<FunctionType> ( std::forward<FunctionType> ( Function ) ) );
+                }
+
+            void RemoveSystem ( CEEntitySystemBase * System );
+
+            // Runs every enabled system of the group; call from the game thread
+            void RunGroup ( CETickGroup Group, float DeltaTime );
+
+            bool HasSystems ( CETickGroup Group ) const { return !Groups[ static_cast< int >( Group ) ].Systems.empty (); }
+            uint32 GetWaveCount ( CETickGroup Group );
+            size_t GetSystemCount () const { return Systems.size (); }
+
+            // Below this many chunks per wave the jobs are not worth dispatching
+            static constexpr uint32 MIN_PARALLEL_CHUNKS = 4;
+
+        private:
+            struct CESystemWorkItem
+                {
+                CEEntitySystemBase * System;
+                CEArchetype * Archetype;
+                uint32 Chunk;
+                };
+
+            struct CESystemGroup
+                {
+                std::vector<CEEntitySystemBase *> Systems;          // registration order
+                std::vector<std::vector<CEEntitySystemBase *>> Waves;
+                bool bWavesDirty = false;
+                };
+
+            void RegisterSystem ( std::unique_ptr<CEEntitySystemBase> System );
+            void RebuildWaves ( CESystemGroup & Group );
+            static void ExecuteWorkItems ( void * Context, uint32 Begin, uint32 End );
+
+            CEEntityStorage & Storage;
+            std::vector<std::unique_ptr<CEEntitySystemBase>> Systems;
+            CESystemGroup Groups[ static_cast< int >( CETickGroup::MAX ) ];
+            std::vector<CESystemWorkItem> WorkItems; // reused between waves
+            float CurrentDeltaTime = 0.0f;
+        };
+    }
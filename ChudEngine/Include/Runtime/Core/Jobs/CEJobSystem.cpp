@@ -0,0 +1,357 @@
+#include "Core/Jobs/CEJobSystem.hpp"
+#include "Utils/Logger.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CE
+    {
+    namespace
+        {
+        constexpr uint32 DEQUE_CAPACITY = 4096; // power of two
+        constexpr uint32 DEQUE_MASK = DEQUE_CAPACITY - 1;
+
+        // Bounded deque guarded by a short spin lock. The owner pushes and pops at the
+        // back (LIFO, cache-warm), thieves take from the front, so they rarely collide.
+        class CEWorkStealingDeque
+            {
+            public:
+                bool Push ( const CEJob & Job )
+                    {
+                    Lock ();
+                    bool bPushed = Tail - Head < DEQUE_CAPACITY;
+                    if (bPushed)
+                        {
+                        Jobs[ Tail & DEQUE_MASK ] = Job;
+                        ++Tail;
+                        }
+                    Unlock ();
+                    return bPushed;
+                    }
+
+                bool Pop ( CEJob & OutJob )
+                    {
+                    Lock ();
+                    bool bPopped = Tail != Head;
+                    if (bPopped)
+                        {
+                        --Tail;
+                        OutJob = Jobs[ Tail & DEQUE_MASK ];
+                        }
+                    Unlock ();
+                    return bPopped;
+                    }
+
+                bool Steal ( CEJob & OutJob )
+                    {
+                    Lock ();
+                    bool bStolen = Tail != Head;
+                    if (bStolen)
+                        {
+                        OutJob = Jobs[ Head & DEQUE_MASK ];
+                        ++Head;
+                        }
+                    Unlock ();
+                    return bStolen;
+                    }
+
+            private:
+                void Lock ()
+                    {
+                    while (Flag.test_and_set ( std::memory_order_acquire ))
+                        {
+                        while (Flag.test ( std::memory_order_relaxed ))
+                            {
+                            std::this_thread::yield ();
+                            }
+                        }
+                    }
+
+                void Unlock () { Flag.clear ( std::memory_order_release ); }
+
+                std::atomic_flag Flag;
+                uint32 Head = 0;
+                uint32 Tail = 0;
+                CEJob Jobs[ DEQUE_CAPACITY ];
+            };
+
+            // Each worker on its own cache lines so deque locks do not false-share
+        struct alignas( 64 ) CEJobWorker
+            {
+            CEWorkStealingDeque Deque;
+            std::thread Thread;
+            };
+
+        std::vector<std::unique_ptr<CEJobWorker>> Workers; // [0] = game thread, no std::thread
+        std::atomic<bool> bRunning { false };
+        std::atomic<int32> QueuedJobs { 0 };
+
+        std::mutex SleepMutex;
+        std::condition_variable SleepCondition;
+
+        // Jobs submitted from threads that are not part of the pool
+        std::mutex InjectionMutex;
+        std::deque<CEJob> InjectionQueue;
+
+        thread_local uint32 WorkerIndex = CEJobSystem::INVALID_WORKER;
+        thread_local uint32 StealSeed = 0;
+
+        void WakeWorkers ( uint32 Count )
+            {
+                // Empty critical section orders the QueuedJobs increment with a sleeper's predicate check
+            {
+            std::lock_guard<std::mutex> lock ( SleepMutex );
+            }
+
+            if (Count > 1)
+                {
+                SleepCondition.notify_all ();
+                }
+            else
+                {
+                SleepCondition.notify_one ();
+                }
+            }
+
+        bool TakeJob ( uint32 Index, CEJob & OutJob )
+            {
+            if (QueuedJobs.load ( std::memory_order_acquire ) <= 0) return false;
+
+            bool bFound = Index < Workers.size () && Workers[ Index ]->Deque.Pop ( OutJob );
+
+            if (!bFound)
+                {
+                std::lock_guard<std::mutex> lock ( InjectionMutex );
+                if (!InjectionQueue.empty ())
+                    {
+                    OutJob = InjectionQueue.front ();
+                    InjectionQueue.pop_front ();
+                    bFound = true;
+                    }
+                }
+
+            if (!bFound)
+                {
+                    // Start from a pseudo-random victim so thieves spread out
+                uint32 workerCount = static_cast< uint32 >( Workers.size () );
+                StealSeed = StealSeed * 1664525u + 1013904223u;
+                uint32 start = StealSeed % workerCount;
+                for (uint32 i = 0; i < workerCount && !bFound; ++i)
+                    {
+                    uint32 victim = ( start + i ) % workerCount;
+                    if (victim != Index)
+                        {
+                        bFound = Workers[ victim ]->Deque.Steal ( OutJob );
+                        }
+                    }
+                }
+
+            if (bFound)
+                {
+                QueuedJobs.fetch_sub ( 1, std::memory_order_acq_rel );
+                }
+            return bFound;
+            }
+
+        bool EnqueueJob ( const CEJob & Job )
+            {
+            if (WorkerIndex < Workers.size ())
+                {
+                if (!Workers[ WorkerIndex ]->Deque.Push ( Job ))
+                    {
+                    return false;
+                    }
+                }
+            else
+                {
+                std::lock_guard<std::mutex> lock ( InjectionMutex );
+                InjectionQueue.push_back ( Job );
+                }
+
+            QueuedJobs.fetch_add ( 1, std::memory_order_release );
+            return true;
+            }
+        }
+
+    void CEJobSystem::Init ( uint32 NumWorkers )
+        {
+        if (IsInitialized ()) return;
+
+        if (NumWorkers == 0)
+            {
+            uint32 hardwareThreads = std::thread::hardware_concurrency ();
+            NumWorkers = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+            }
+
+        Workers.clear ();
+        for (uint32 i = 0; i <= NumWorkers; ++i)
+            {
+            Workers.push_back ( std::make_unique<CEJobWorker> () );
+            }
+
+        WorkerIndex = 0;
+        StealSeed = 0x9E3779B9u;
+        bRunning.store ( true, std::memory_order_release );
+
+        for (uint32 i = 1; i <= NumWorkers; ++i)
+            {
+            Workers[ i ]->Thread = std::thread ( &CEJobSystem::WorkerLoop, i );
+            }
+
+        CE_CORE_INFO ( "JobSystem: started {} worker threads", NumWorkers );
+        }
+
+    void CEJobSystem::Shutdown ()
+        {
+        if (!IsInitialized ()) return;
+
+        bRunning.store ( false, std::memory_order_release );
+        WakeWorkers ( static_cast< uint32 >( Workers.size () ) );
+
+        for (auto & worker : Workers)
+            {
+            if (worker->Thread.joinable ())
+                {
+                worker->Thread.join ();
+                }
+            }
+
+        Workers.clear ();
+        InjectionQueue.clear ();
+        QueuedJobs.store ( 0, std::memory_order_release );
+        WorkerIndex = INVALID_WORKER;
+
+        CE_CORE_INFO ( "JobSystem: shut down" );
+        }
+
+    bool CEJobSystem::IsInitialized ()
+        {
+        return bRunning.load ( std::memory_order_acquire );
+        }
+
+    uint32 CEJobSystem::GetNumWorkers ()
+        {
+        return Workers.empty () ? 0 : static_cast< uint32 >( Workers.size () - 1 );
+        }
+
+    uint32 CEJobSystem::GetWorkerIndex ()
+        {
+        return WorkerIndex;
+        }
+
+    void CEJobSystem::Submit ( const CEJob & Job )
+        {
+        if (!Job.Function) return;
+
+        if (Job.Counter)
+            {
+            Job.Counter->Pending.fetch_add ( 1, std::memory_order_relaxed );
+            }
+
+        // Without workers, or with a full deque, run in place
+        if (!IsInitialized () || !EnqueueJob ( Job ))
+            {
+            ExecuteJob ( Job );
+            return;
+            }
+
+        WakeWorkers ( 1 );
+        }
+
+    void CEJobSystem::Dispatch ( uint32 Count, uint32 GrainSize, CEJobFunction Function, void * Context, CEJobCounter & Counter )
+        {
+        if (Count == 0 || !Function) return;
+
+        if (!IsInitialized ())
+            {
+            Function ( Context, 0, Count );
+            return;
+            }
+
+        GrainSize = std::max<uint32> ( GrainSize, 1 );
+        uint32 chunkCount = ( Count + GrainSize - 1 ) / GrainSize;
+        Counter.Pending.fetch_add ( chunkCount, std::memory_order_relaxed );
+
+        uint32 queued = 0;
+        for (uint32 begin = 0; begin < Count; begin += GrainSize)
+            {
+            CEJob job;
+            job.Function = Function;
+            job.Context = Context;
+            job.Begin = begin;
+            job.End = std::min ( Count, begin + GrainSize );
+            job.Counter = &Counter;
+
+            if (EnqueueJob ( job ))
+                {
+                ++queued;
+                }
+            else
+                {
+                ExecuteJob ( job );
+                }
+            }
+
+        if (queued > 0)
+            {
+            WakeWorkers ( queued );
+            }
+        }
+
+    void CEJobSystem::ExecuteJob ( const CEJob & Job )
+        {
+        Job.Function ( Job.Context, Job.Begin, Job.End );
+        if (Job.Counter)
+            {
+            Job.Counter->Pending.fetch_sub ( 1, std::memory_order_release );
+            }
+        }
+
+    void CEJobSystem::WorkerLoop ( uint32 Index )
+        {
+        WorkerIndex = Index;
+        StealSeed = Index * 2654435761u;
+
+        while (bRunning.load ( std::memory_order_acquire ))
+            {
+            CEJob job;
+            if (TakeJob ( Index, job ))
+                {
+                ExecuteJob ( job );
+                continue;
+                }
+
+            std::unique_lock<std::mutex> lock ( SleepMutex );
+            SleepCondition.wait ( lock, []
+                                  {
+                                  return QueuedJobs.load ( std::memory_order_acquire ) > 0
+                                      || !bRunning.load ( std::memory_order_acquire );
+                                  } );
+            }
+        }
+
+    void CEJobSystem::Wait ( CEJobCounter & Counter )
+        {
+        while (!Counter.IsDone ())
+            {
+            if (!TryExecuteJob ())
+                {
+                std::this_thread::yield ();
+                }
+            }
+        }
+
+    bool CEJobSystem::TryExecuteJob ()
+        {
+        CEJob job;
+        if (IsInitialized () && TakeJob ( WorkerIndex, job ))
+            {
+            ExecuteJob ( job );
+            return true;
+            }
+        return false;
+        }
+    }
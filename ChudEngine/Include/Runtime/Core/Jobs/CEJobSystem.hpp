@@ -0,0 +1,87 @@
+// Runtime/Core/Jobs/CEJobSystem.hpp
+#pragma once
+#include "Core/CoreTypes.hpp"
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+namespace CE
+    {
+        // Job body: processes the index range [Begin, End)
+    using CEJobFunction = void ( * )( void * Context, uint32 Begin, uint32 End );
+
+    // Number of unfinished jobs; CEJobSystem::Wait returns once it reaches zero
+    class CEJobCounter
+        {
+        public:
+            CEJobCounter () = default;
+            CEJobCounter ( const CEJobCounter & ) = delete;
+            CEJobCounter & operator=( const CEJobCounter & ) = delete;
+
+            bool IsDone () const { return Pending.load ( std::memory_order_acquire ) == 0; }
+
+        private:
+            friend class CEJobSystem;
+            std::atomic<uint32> Pending { 0 };
+        };
+
+    struct CEJob
+        {
+        CEJobFunction Function = nullptr;
+        void * Context = nullptr;
+        uint32 Begin = 0;
+        uint32 End = 0;
+        CEJobCounter * Counter = nullptr;
+        };
+
+    // Worker pool with a deque per thread and work stealing.
+    // The thread that calls Init is the game thread (index 0); it runs jobs too while inside Wait.
+    class CEJobSystem
+        {
+        public:
+            static constexpr uint32 INVALID_WORKER = UINT32_MAX;
+
+            static void Init ( uint32 NumWorkers = 0 ); // 0 = hardware_concurrency - 1
+            static void Shutdown ();
+
+            static bool IsInitialized ();
+            static uint32 GetNumWorkers ();
+            static uint32 GetWorkerIndex ();
+
+            // Scheduling
+            static void Submit ( const CEJob & Job );
+            static void Dispatch ( uint32 Count, uint32 GrainSize, CEJobFunction Function, void * Context, CEJobCounter & Counter );
+
+            // Blocks until Counter is done, executing queued jobs meanwhile
+            static void Wait ( CEJobCounter & Counter );
+
+            // Runs one queued job on the calling thread; false if nothing was found
+            static bool TryExecuteJob ();
+
+            // Calls Function ( uint32 Index ) for every index in [0, Count)
+            template<typename FunctionType>
+            static void ParallelFor ( uint32 Count, uint32 GrainSize, FunctionType && Function )
+                {
+                if (Count == 0) return;
+
+                using BodyType = std::remove_reference_t<FunctionType>;
+                CEJobFunction trampoline = [] ( void * Context, uint32 Begin, uint32 End )
+                    {
+                    BodyType & body = *static_cast< BodyType * >( Context );
+                    for (uint32 i = Begin; i < End; ++i)
+                        {
+                        body ( i );
+                        }
+                    };
+
+                CEJobCounter counter;
+                Dispatch ( Count, GrainSize, trampoline,
+                           const_cast< void * >( static_cast< const void * >( std::addressof ( Function ) ) ), counter );
+                Wait ( counter );
+                }
+
+        private:
+            static void ExecuteJob ( const CEJob & Job );
+            static void WorkerLoop ( uint32 Index );
+        };
+    }
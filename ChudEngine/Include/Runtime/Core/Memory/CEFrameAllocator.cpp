@@ -0,0 +1,137 @@
+#include "Core/Memory/CEFrameAllocator.hpp"
+#include "Utils/Logger.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace CE
+    {
+    namespace
+        {
+        unsigned char * ArenaBase = nullptr; // kept after Shutdown, see there
+        size_t ArenaBytes = 0;
+        bool bActive = false;
+        size_t FrameBytes = 0;
+        uint32 FrameBufferCount = 0;
+
+        unsigned char * FrameBuffer = nullptr; // buffer of the current frame
+        std::atomic<size_t> FrameOffset { 0 };
+        uint64 FrameNumber = 0;
+        uint64 PeakBytesUsed = 0;
+
+        std::atomic<uint64> FrameAllocations { 0 };
+        std::atomic<uint64> FrameHeapFallbacks { 0 };
+        std::atomic<uint64> TotalHeapFallbacks { 0 };
+
+        void * AllocateFromHeap ( size_t Size, size_t Alignment )
+            {
+            FrameHeapFallbacks.fetch_add ( 1, std::memory_order_relaxed );
+            TotalHeapFallbacks.fetch_add ( 1, std::memory_order_relaxed );
+            return ::operator new( Size, std::align_val_t ( Alignment ) );
+            }
+        }
+
+    void CEFrameAllocator::Init ( size_t BytesPerFrame, uint32 FrameCount )
+        {
+        if (bActive) return;
+
+        if (ArenaBase)
+            {
+                // Init after Shutdown: blocks of the old arena may still be freed, so it is reused as laid out
+            if (BytesPerFrame != FrameBytes || std::max ( FrameCount, 1u ) != FrameBufferCount)
+                {
+                CE_CORE_WARN ( "FrameAllocator: re-initialized with a different size, keeping {} buffers of {} KB",
+                               FrameBufferCount, FrameBytes / 1024 );
+                }
+            }
+        else
+            {
+            FrameBytes = BytesPerFrame;
+            FrameBufferCount = std::max ( FrameCount, 1u );
+            ArenaBytes = FrameBytes * FrameBufferCount;
+            ArenaBase = static_cast< unsigned char * >( ::operator new( ArenaBytes, std::align_val_t ( 64 ) ) );
+            }
+        bActive = true;
+        FrameBuffer = ArenaBase + ( FrameNumber % FrameBufferCount ) * FrameBytes;
+        FrameOffset.store ( 0, std::memory_order_relaxed );
+
+        CE_CORE_DEBUG ( "FrameAllocator: {} buffers of {} KB", FrameBufferCount, FrameBytes / 1024 );
+        }
+
+    void CEFrameAllocator::Shutdown ()
+        {
+        if (!bActive) return;
+
+            // The arena itself stays reserved until process exit: containers that outlive Shutdown
+            // still hand their frame blocks to Free, which must recognize them and leave them alone
+        bActive = false;
+        FrameBuffer = nullptr;
+        FrameOffset.store ( 0, std::memory_order_relaxed );
+        }
+
+    bool CEFrameAllocator::IsInitialized ()
+        {
+        return bActive;
+        }
+
+    void CEFrameAllocator::BeginFrame ()
+        {
+        if (!bActive) return;
+
+        PeakBytesUsed = std::max<uint64> ( PeakBytesUsed, std::min ( FrameOffset.load ( std::memory_order_relaxed ), FrameBytes ) );
+
+        ++FrameNumber;
+        FrameBuffer = ArenaBase + ( FrameNumber % FrameBufferCount ) * FrameBytes;
+        FrameOffset.store ( 0, std::memory_order_relaxed );
+        FrameAllocations.store ( 0, std::memory_order_relaxed );
+        FrameHeapFallbacks.store ( 0, std::memory_order_relaxed );
+        }
+
+    void * CEFrameAllocator::Allocate ( size_t Size, size_t Alignment )
+        {
+        if (!bActive)
+            {
+            return ::operator new( Size, std::align_val_t ( Alignment ) );
+            }
+
+        FrameAllocations.fetch_add ( 1, std::memory_order_relaxed );
+
+        size_t offset = FrameOffset.load ( std::memory_order_relaxed );
+        size_t aligned = 0;
+        do
+            {
+            aligned = ( offset + Alignment - 1 ) & ~( Alignment - 1 );
+            if (aligned + Size > FrameBytes)
+                {
+                return AllocateFromHeap ( Size, Alignment );
+                }
+            }
+        while (!FrameOffset.compare_exchange_weak ( offset, aligned + Size, std::memory_order_relaxed ));
+
+        return FrameBuffer + aligned;
+        }
+
+    void CEFrameAllocator::Free ( void * Block, size_t Alignment )
+        {
+        if (!Block || Owns ( Block )) return;
+
+        ::operator delete( Block, std::align_val_t ( Alignment ) );
+        }
+
+    bool CEFrameAllocator::Owns ( const void * Block )
+        {
+        const unsigned char * pointer = static_cast< const unsigned char * >( Block );
+        return ArenaBase && pointer >= ArenaBase && pointer < ArenaBase + ArenaBytes;
+        }
+
+    CEFrameAllocatorStats CEFrameAllocator::GetStats ()
+        {
+        CEFrameAllocatorStats stats;
+        stats.FrameNumber = FrameNumber;
+        stats.BytesUsed = std::min ( FrameOffset.load ( std::memory_order_relaxed ), FrameBytes );
+        stats.PeakBytesUsed = std::max ( PeakBytesUsed, stats.BytesUsed );
+        stats.Allocations = FrameAllocations.load ( std::memory_order_relaxed );
+        stats.HeapFallbacks = FrameHeapFallbacks.load ( std::memory_order_relaxed );
+        stats.TotalHeapFallbacks = TotalHeapFallbacks.load ( std::memory_order_relaxed );
+        return stats;
+        }
+    }
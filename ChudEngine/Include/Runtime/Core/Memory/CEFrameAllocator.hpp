@@ -0,0 +1,88 @@
+// Runtime/Core/Memory/CEFrameAllocator.hpp
+#pragma once
+#include "Core/CoreTypes.hpp"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace CE
+    {
+    struct CEFrameAllocatorStats
+        {
+        uint64 FrameNumber = 0;
+        uint64 BytesUsed = 0;            // in the current frame's buffer
+        uint64 PeakBytesUsed = 0;        // over all frames so far
+        uint64 Allocations = 0;          // in the current frame, buffer and heap fallbacks together
+        uint64 HeapFallbacks = 0;        // current frame allocations that did not fit the buffer
+        uint64 TotalHeapFallbacks = 0;
+        };
+
+    // Linear scratch memory for data that lives at most a few frames. The arena is split into
+    // one buffer per frame; BeginFrame moves to the next buffer and resets it, so memory taken in
+    // frame N stays valid until FrameCount - 1 more frames have begun. With FrameCount matching the
+    // renderer's frames in flight plus one, data handed to the GPU side is never reset under it.
+    // Allocate is a lock-free bump and may be called from any thread; BeginFrame is game thread only.
+    // When a buffer runs out (or outside Init/Shutdown), allocations fall back to the general heap.
+    // Shutdown keeps the arena reserved, so frame blocks freed after it are still recognized.
+    class CEFrameAllocator
+        {
+        public:
+            static void Init ( size_t BytesPerFrame = DEFAULT_BYTES_PER_FRAME, uint32 FrameCount = DEFAULT_FRAME_COUNT );
+            static void Shutdown ();
+            static bool IsInitialized ();
+
+            // Call once at the start of every frame, before anything allocates for it
+            static void BeginFrame ();
+
+            static void * Allocate ( size_t Size, size_t Alignment = alignof( std::max_align_t ) );
+
+            // Frees heap fallbacks only; frame memory is reclaimed when its buffer comes around again
+            static void Free ( void * Block, size_t Alignment = alignof( std::max_align_t ) );
+
+            static bool Owns ( const void * Block );
+            static CEFrameAllocatorStats GetStats ();
+
+            static constexpr size_t DEFAULT_BYTES_PER_FRAME = 4 * 1024 * 1024;
+            static constexpr uint32 DEFAULT_FRAME_COUNT = 3;
+        };
+
+    // STL allocator over CEFrameAllocator. Containers using it must not outlive their frame window;
+    // deallocate is free for frame memory, so growing vectors should reserve up front.
+    template<typename T>
+    class CEFrameStdAllocator
+        {
+        public:
+            using value_type = T;
+
+            CEFrameStdAllocator () noexcept = default;
+
+            template<typename U>
+            CEFrameStdAllocator ( const CEFrameStdAllocator<U> & ) noexcept { }
+
+            T * allocate ( size_t Count )
+                {
+                return static_cast< T * >( CEFrameAllocator::Allocate ( Count * sizeof ( T ), alignof( T ) ) );
+                }
+
+            void deallocate ( T * Block, size_t ) noexcept
+                {
+                CEFrameAllocator::Free ( Block, alignof( T ) );
+                }
+
+            template<typename U>
+            bool operator==( const CEFrameStdAllocator<U> & ) const noexcept { return true; }
+
+            template<typename U>
+            bool operator!=( const CEFrameStdAllocator<U> & ) const noexcept { return false; }
+        };
+
+    template<typename T>
+    using CEFrameVector = std::vector<T, CEFrameStdAllocator<T>>;
+
+    // Allocator policy for CEArray over frame memory: CEArray<T, CEFrameArrayAllocator>
+    struct CEFrameArrayAllocator
+        {
+        static void * Allocate ( size_t Bytes, size_t Alignment ) { return CEFrameAllocator::Allocate ( Bytes, Alignment ); }
+        static void Free ( void * Block, size_t, size_t Alignment ) { CEFrameAllocator::Free ( Block, Alignment ); }
+        };
+    }
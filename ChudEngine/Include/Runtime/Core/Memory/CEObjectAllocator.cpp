@@ -0,0 +1,223 @@
+#include "Core/Memory/CEObjectAllocator.hpp"
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace CE
+    {
+    namespace
+        {
+        constexpr uint32 CACHE_REFILL_COUNT = 32; // blocks taken from the pool per refill
+        constexpr uint32 CACHE_MAX_COUNT = 64;    // above this, half of the thread cache goes back
+
+        struct CEFreeBlock
+            {
+            CEFreeBlock * Next;
+            };
+
+        struct CEObjectPool
+            {
+            std::mutex Mutex;
+            CEFreeBlock * FreeList = nullptr;
+            unsigned char * SlabCursor = nullptr; // uncarved rest of the newest slab
+            unsigned char * SlabEnd = nullptr;
+            uint64 SlabBytes = 0;
+            uint64 BlockCount = 0;
+            std::atomic<int64> LiveObjects { 0 };
+            std::atomic<uint64> Allocations { 0 };
+            };
+
+        // Never destroyed: objects may still be freed during static destruction
+        CEObjectPool * GetPools ()
+            {
+            static CEObjectPool * Pools = new CEObjectPool[ CEObjectAllocator::SIZE_CLASS_COUNT ];
+            return Pools;
+            }
+
+        struct CEThreadCache
+            {
+            CEFreeBlock * Head;
+            uint32 Count;
+            int64 LiveDelta;
+            uint64 Allocations;
+            };
+
+        // Trivially destructible, so it stays usable after the flusher below has run
+        thread_local CEThreadCache ThreadCaches[ CEObjectAllocator::SIZE_CLASS_COUNT ];
+
+        size_t GetSizeClass ( size_t Size )
+            {
+            return ( Size - 1 ) / CEObjectAllocator::SIZE_CLASS_GRANULARITY;
+            }
+
+        // Call with the pool locked
+        void FoldCounters ( CEObjectPool & Pool, CEThreadCache & Cache )
+            {
+            Pool.LiveObjects.fetch_add ( Cache.LiveDelta, std::memory_order_relaxed );
+            Pool.Allocations.fetch_add ( Cache.Allocations, std::memory_order_relaxed );
+            Cache.LiveDelta = 0;
+            Cache.Allocations = 0;
+            }
+
+        // Moves the first Count blocks of the thread cache back to the pool
+        void DrainCache ( size_t SizeClass, uint32 Count )
+            {
+            CEThreadCache & cache = ThreadCaches[ SizeClass ];
+            CEObjectPool & pool = GetPools ()[ SizeClass ];
+
+            std::lock_guard<std::mutex> lock ( pool.Mutex );
+            FoldCounters ( pool, cache );
+            if (Count == 0) return;
+
+            CEFreeBlock * first = cache.Head;
+            CEFreeBlock * last = first;
+            for (uint32 i = 1; i < Count; ++i)
+                {
+                last = last->Next;
+                }
+            cache.Head = last->Next;
+            cache.Count -= Count;
+
+            last->Next = pool.FreeList;
+            pool.FreeList = first;
+            }
+
+        struct CEThreadCacheFlusher
+            {
+            bool bUsed = false;
+
+            ~CEThreadCacheFlusher ()
+                {
+                for (size_t sizeClass = 0; sizeClass < CEObjectAllocator::SIZE_CLASS_COUNT; ++sizeClass)
+                    {
+                    if (ThreadCaches[ sizeClass ].Head || ThreadCaches[ sizeClass ].LiveDelta != 0)
+                        {
+                        DrainCache ( sizeClass, ThreadCaches[ sizeClass ].Count );
+                        }
+                    }
+                }
+            };
+
+        thread_local CEThreadCacheFlusher ThreadCacheFlusher;
+
+        void RefillCache ( size_t SizeClass )
+            {
+                // The first refill on a thread constructs the flusher, which returns the cache at thread exit
+            ThreadCacheFlusher.bUsed = true;
+
+            CEThreadCache & cache = ThreadCaches[ SizeClass ];
+            CEObjectPool & pool = GetPools ()[ SizeClass ];
+            size_t blockSize = ( SizeClass + 1 ) * CEObjectAllocator::SIZE_CLASS_GRANULARITY;
+
+            std::lock_guard<std::mutex> lock ( pool.Mutex );
+            for (uint32 i = 0; i < CACHE_REFILL_COUNT; ++i)
+                {
+                CEFreeBlock * block = pool.FreeList;
+                if (block)
+                    {
+                    pool.FreeList = block->Next;
+                    }
+                else
+                    {
+                    if (static_cast< size_t >( pool.SlabEnd - pool.SlabCursor ) < blockSize)
+                        {
+                        pool.SlabCursor = static_cast< unsigned char * >(
+                            ::operator new( CEObjectAllocator::SLAB_BYTES, std::align_val_t ( 64 ) ) );
+                        pool.SlabEnd = pool.SlabCursor + CEObjectAllocator::SLAB_BYTES;
+                        pool.SlabBytes += CEObjectAllocator::SLAB_BYTES;
+                        }
+                    block = reinterpret_cast< CEFreeBlock * >( pool.SlabCursor );
+                    pool.SlabCursor += blockSize;
+                    ++pool.BlockCount;
+                    }
+
+                block->Next = cache.Head;
+                cache.Head = block;
+                ++cache.Count;
+                }
+            FoldCounters ( pool, cache );
+            }
+        }
+
+    void * CEObjectAllocator::Allocate ( size_t Size )
+        {
+        if (!IsPooledSize ( Size ))
+            {
+            return ::operator new( Size );
+            }
+
+        size_t sizeClass = GetSizeClass ( Size );
+        CEThreadCache & cache = ThreadCaches[ sizeClass ];
+        if (!cache.Head)
+            {
+            RefillCache ( sizeClass );
+            }
+
+        CEFreeBlock * block = cache.Head;
+        cache.Head = block->Next;
+        --cache.Count;
+        ++cache.LiveDelta;
+        ++cache.Allocations;
+        return block;
+        }
+
+    void CEObjectAllocator::Free ( void * Block, size_t Size )
+        {
+        if (!Block) return;
+
+        if (!IsPooledSize ( Size ))
+            {
+            ::operator delete( Block );
+            return;
+            }
+
+            // The block may come from another thread's cache; it simply joins this one
+        size_t sizeClass = GetSizeClass ( Size );
+        CEThreadCache & cache = ThreadCaches[ sizeClass ];
+        CEFreeBlock * block = static_cast< CEFreeBlock * >( Block );
+        block->Next = cache.Head;
+        cache.Head = block;
+        ++cache.Count;
+        --cache.LiveDelta;
+
+        if (cache.Count == 1)
+            {
+            ThreadCacheFlusher.bUsed = true; // threads that only free must return their cache too
+            }
+        else if (cache.Count > CACHE_MAX_COUNT)
+            {
+            DrainCache ( sizeClass, CACHE_MAX_COUNT / 2 );
+            }
+        }
+
+    CEObjectPoolStats CEObjectAllocator::GetPoolStatsForSize ( size_t Size )
+        {
+        CEObjectPoolStats stats;
+        if (!IsPooledSize ( Size )) return stats;
+
+        size_t sizeClass = GetSizeClass ( Size );
+        CEObjectPool & pool = GetPools ()[ sizeClass ];
+
+        std::lock_guard<std::mutex> lock ( pool.Mutex );
+        stats.BlockSize = static_cast< uint32 >( ( sizeClass + 1 ) * SIZE_CLASS_GRANULARITY );
+        stats.SlabBytes = pool.SlabBytes;
+        stats.BlockCount = pool.BlockCount;
+        stats.LiveObjects = pool.LiveObjects.load ( std::memory_order_relaxed );
+        stats.Allocations = pool.Allocations.load ( std::memory_order_relaxed );
+        return stats;
+        }
+
+    std::vector<CEObjectPoolStats> CEObjectAllocator::GetAllPoolStats ()
+        {
+        std::vector<CEObjectPoolStats> result;
+        for (size_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; ++sizeClass)
+            {
+            CEObjectPoolStats stats = GetPoolStatsForSize ( ( sizeClass + 1 ) * SIZE_CLASS_GRANULARITY );
+            if (stats.SlabBytes > 0)
+                {
+                result.push_back ( stats );
+                }
+            }
+        return result;
+        }
+    }
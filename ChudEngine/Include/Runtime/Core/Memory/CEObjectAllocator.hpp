@@ -0,0 +1,46 @@
+// Runtime/Core/Memory/CEObjectAllocator.hpp
+#pragma once
+#include "Core/CoreTypes.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace CE
+    {
+        // Usage of one size-class pool. LiveObjects and Allocations are folded in from the
+        // thread caches in batches, so they may lag by a few dozen blocks per thread.
+    struct CEObjectPoolStats
+        {
+        uint32 BlockSize = 0;
+        uint64 SlabBytes = 0;       // memory reserved from the system for this pool
+        uint64 BlockCount = 0;      // blocks carved from the slabs so far
+        int64 LiveObjects = 0;
+        uint64 Allocations = 0;     // total since startup
+        };
+
+    // Slab allocator behind CEObject's operator new/delete. Every object size is rounded up to a
+    // 16-byte size class; blocks of one class are carved from 64 KB slabs, so objects of the same
+    // type end up next to each other. Each thread keeps a free list per size class and only takes
+    // the pool lock to refill or drain it in batches. Slabs are never returned to the system.
+    class CEObjectAllocator
+        {
+        public:
+            static void * Allocate ( size_t Size );
+            static void Free ( void * Block, size_t Size );
+
+            static bool IsPooledSize ( size_t Size ) { return Size != 0 && Size <= MAX_POOLED_SIZE; }
+
+            // Stats of the pool objects of the given size come from (zeroed for unpooled sizes)
+            static CEObjectPoolStats GetPoolStatsForSize ( size_t Size );
+
+            template<typename T>
+            static CEObjectPoolStats GetPoolStats () { return GetPoolStatsForSize ( sizeof ( T ) ); }
+
+            // Every pool that has reserved a slab, for memory reports
+            static std::vector<CEObjectPoolStats> GetAllPoolStats ();
+
+            static constexpr size_t SIZE_CLASS_GRANULARITY = 16;
+            static constexpr size_t MAX_POOLED_SIZE = 1024; // larger objects go to the general heap
+            static constexpr size_t SIZE_CLASS_COUNT = MAX_POOLED_SIZE / SIZE_CLASS_GRANULARITY;
+            static constexpr size_t SLAB_BYTES = 64 * 1024;
+        };
+    }
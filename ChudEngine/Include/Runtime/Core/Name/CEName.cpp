@@ -0,0 +1,205 @@
+#include "Core/Name/CEName.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace CE
+    {
+    namespace
+        {
+        constexpr uint32 NAME_PAGE_BITS = 12;
+        constexpr uint32 NAME_PAGE_SIZE = 1u << NAME_PAGE_BITS;
+        constexpr uint32 NAME_PAGE_COUNT = FName::MAX_NAMES / NAME_PAGE_SIZE;
+
+        // Open addressing, kept at most half full so probe chains stay short; doubles when it gets there
+        constexpr uint32 INITIAL_HASH_SLOT_COUNT = 1u << 16;
+
+        struct CENameEntry
+            {
+            std::string Value;
+            uint32 Hash = 0;
+            };
+
+        struct CENameHashTable
+            {
+            uint32 Mask = 0;
+            std::atomic<uint32> * Slots = nullptr; // 0 = empty, otherwise an entry index
+            };
+
+        // Entries never move or die: pages are allocated on demand and leaked at exit on purpose.
+        // Outgrown hash tables are leaked too, since a lookup may still be probing one; together
+        // they stay below the size of the current table.
+        std::atomic<CENameEntry *> NamePages[ NAME_PAGE_COUNT ];
+        std::atomic<CENameHashTable *> HashTable { nullptr };
+        std::atomic<uint32> NextNameIndex { 1 };
+        std::atomic<bool> bNameTableFull { false };
+        std::mutex InsertMutex;
+
+        const std::string NoneString;
+
+        uint32 HashName ( std::string_view Value )
+            {
+            uint32 hash = 2166136261u;
+            for (char c : Value)
+                {
+                hash ^= static_cast< uint8 >( c );
+                hash *= 16777619u;
+                }
+            return hash;
+            }
+
+        CENameEntry & GetEntry ( uint32 Index )
+            {
+            return NamePages[ Index >> NAME_PAGE_BITS ].load ( std::memory_order_acquire )[ Index & ( NAME_PAGE_SIZE - 1 ) ];
+            }
+
+        // Call with InsertMutex locked
+        CENameEntry & AllocateEntry ( uint32 Index )
+            {
+            std::atomic<CENameEntry *> & page = NamePages[ Index >> NAME_PAGE_BITS ];
+            CENameEntry * pageEntries = page.load ( std::memory_order_relaxed );
+            if (!pageEntries)
+                {
+                pageEntries = new CENameEntry[ NAME_PAGE_SIZE ];
+                page.store ( pageEntries, std::memory_order_release );
+                }
+            return pageEntries[ Index & ( NAME_PAGE_SIZE - 1 ) ];
+            }
+
+        CENameHashTable * CreateHashTable ( uint32 SlotCount )
+            {
+            CENameHashTable * table = new CENameHashTable;
+            table->Mask = SlotCount - 1;
+            table->Slots = new std::atomic<uint32>[ SlotCount ] ();
+            return table;
+            }
+
+        // Returns the entry index, or 0 with OutSlot at the first empty slot of the probe chain
+        uint32 FindName ( const CENameHashTable & Table, std::string_view Value, uint32 Hash, uint32 & OutSlot )
+            {
+            for (uint32 slot = Hash & Table.Mask;; slot = ( slot + 1 ) & Table.Mask)
+                {
+                uint32 index = Table.Slots[ slot ].load ( std::memory_order_acquire );
+                if (index == 0)
+                    {
+                    OutSlot = slot;
+                    return 0;
+                    }
+                const CENameEntry & entry = GetEntry ( index );
+                if (entry.Hash == Hash && entry.Value == Value)
+                    {
+                    return index;
+                    }
+                }
+            }
+
+        // Call with InsertMutex locked. Builds the doubled table completely before publishing it,
+        // so a lookup sees either the old table or the new one, never a half-filled one.
+        CENameHashTable * GrowHashTable ( const CENameHashTable & Table )
+            {
+            CENameHashTable * grown = CreateHashTable ( ( Table.Mask + 1 ) * 2 );
+            for (uint32 slot = 0; slot <= Table.Mask; ++slot)
+                {
+                uint32 index = Table.Slots[ slot ].load ( std::memory_order_relaxed );
+                if (index == 0) continue;
+
+                uint32 newSlot = GetEntry ( index ).Hash & grown->Mask;
+                while (grown->Slots[ newSlot ].load ( std::memory_order_relaxed ) != 0)
+                    {
+                    newSlot = ( newSlot + 1 ) & grown->Mask;
+                    }
+                grown->Slots[ newSlot ].store ( index, std::memory_order_relaxed );
+                }
+            HashTable.store ( grown, std::memory_order_release );
+            return grown;
+            }
+
+        uint32 InternName ( std::string_view Value )
+            {
+            uint32 hash = HashName ( Value );
+            uint32 slot = 0;
+
+                // Names that already exist are found without locking
+            if (const CENameHashTable * table = HashTable.load ( std::memory_order_acquire ))
+                {
+                if (uint32 index = FindName ( *table, Value, hash, slot ))
+                    {
+                    return index;
+                    }
+                }
+
+            std::lock_guard<std::mutex> lock ( InsertMutex );
+            CENameHashTable * table = HashTable.load ( std::memory_order_relaxed );
+            if (!table)
+                {
+                table = CreateHashTable ( INITIAL_HASH_SLOT_COUNT );
+                HashTable.store ( table, std::memory_order_release );
+                }
+            if (uint32 index = FindName ( *table, Value, hash, slot ))
+                {
+                return index; // interned by another thread in the meantime
+                }
+
+            uint32 newIndex = NextNameIndex.load ( std::memory_order_relaxed );
+            if (newIndex >= FName::MAX_NAMES)
+                {
+                if (!bNameTableFull.exchange ( true, std::memory_order_relaxed ))
+                    {
+                    CE_CORE_CRITICAL ( "FName table is full ({} names), '{}' and every later new name become None",
+                                       FName::MAX_NAMES, Value );
+                    }
+                CE_CORE_ASSERT ( false, "FName table is full" );
+                return 0;
+                }
+
+            CENameEntry & entry = AllocateEntry ( newIndex );
+            entry.Value.assign ( Value.data (), Value.size () );
+            entry.Hash = hash;
+
+            if (static_cast< uint64 >( newIndex ) * 2 > table->Mask)
+                {
+                table = GrowHashTable ( *table );
+                FindName ( *table, Value, hash, slot );
+                }
+
+            // Publishing the slot makes the entry visible to lock-free lookups
+            table->Slots[ slot ].store ( newIndex, std::memory_order_release );
+            NextNameIndex.store ( newIndex + 1, std::memory_order_relaxed );
+            return newIndex;
+            }
+        }
+
+    FName::FName ( std::string_view Value )
+        : Index ( Value.empty () ? 0 : InternName ( Value ) )
+        {
+        }
+
+    FName FName::FindExisting ( std::string_view Value )
+        {
+        FName result;
+        if (!Value.empty ())
+            {
+            if (const CENameHashTable * table = HashTable.load ( std::memory_order_acquire ))
+                {
+                uint32 slot = 0;
+                result.Index = FindName ( *table, Value, HashName ( Value ), slot );
+                }
+            }
+        return result;
+        }
+
+    bool FName::IsTableFull ()
+        {
+        return bNameTableFull.load ( std::memory_order_relaxed );
+        }
+
+    uint32 FName::GetNameCount ()
+        {
+        uint32 count = NextNameIndex.load ( std::memory_order_relaxed );
+        return count < MAX_NAMES ? count : MAX_NAMES;
+        }
+
+    const std::string & FName::ToString () const
+        {
+        return Index == 0 ? NoneString : GetEntry ( Index ).Value;
+        }
+    }
@@ -0,0 +1,64 @@
+// Runtime/Core/Name/CEName.hpp
+#pragma once
+#include "Core/CoreTypes.hpp"
+#include <format>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace CE
+    {
+    // Interned, case-sensitive name: a 32-bit index into a global append-only string table.
+    // Copying, comparing and hashing are integer operations; the text is stored once per unique name.
+    // Lookups of existing names are lock-free; new names are added under a lock, and the hash index
+    // grows with the table, so only MAX_NAMES bounds it. Index 0 is None ("").
+    class FName
+        {
+        public:
+            static constexpr uint32 MAX_NAMES = 1u << 28;
+
+            FName () = default;
+            FName ( std::string_view Value );
+            FName ( const char * Value ) : FName ( std::string_view ( Value ? Value : "" ) ) { }
+            FName ( const std::string & Value ) : FName ( std::string_view ( Value ) ) { }
+
+            // Returns None instead of adding Value to the table when it was never interned
+            static FName FindExisting ( std::string_view Value );
+
+            // Number of table entries in use, including None
+            static uint32 GetNameCount ();
+
+            // True once a new name did not fit into the table and was turned into None.
+            // Entries are never freed: every unique name costs its text for the rest of the process.
+            static bool IsTableFull ();
+
+            uint32 GetIndex () const { return Index; }
+            bool IsNone () const { return Index == 0; }
+
+            // The string lives as long as the process, so the reference is safe to keep
+            const std::string & ToString () const;
+            const char * c_str () const { return ToString ().c_str (); }
+
+            bool operator==( const FName & Other ) const { return Index == Other.Index; }
+            bool operator!=( const FName & Other ) const { return Index != Other.Index; }
+            bool operator<( const FName & Other ) const { return Index < Other.Index; } // stable within one run only
+
+        private:
+            uint32 Index = 0;
+        };
+    }
+
+template<>
+struct std::hash<CE::FName>
+    {
+    size_t operator()( const CE::FName & Name ) const noexcept { return Name.GetIndex (); }
+    };
+
+template<>
+struct std::formatter<CE::FName> : std::formatter<std::string_view>
+    {
+    auto format ( const CE::FName & Name, std::format_context & Context ) const
+        {
+        return std::formatter<std::string_view>::format ( Name.ToString (), Context );
+        }
+    };
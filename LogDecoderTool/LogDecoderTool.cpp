@@ -0,0 +1,302 @@
+// Turns a binary log written by Logger::SetBinarySink back into the text format of the regular log
+#include "Utils/BinaryLogFormat.hpp"
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace
+    {
+    using namespace CE::BinaryLog;
+
+    using ArgValue = std::variant<int64_t, uint64_t, double, bool, char, std::string, const void *>;
+
+    struct FormatEntry
+        {
+        uint8_t Level = 0;
+        std::string Category;
+        std::string Format;
+        };
+
+    class RecordReader
+        {
+        public:
+            explicit RecordReader ( const std::string & InData ) : Data ( InData ) { }
+
+            template<typename T>
+            bool Read ( T & Value )
+                {
+                if (Position + sizeof ( T ) > Data.size ()) return false;
+                std::memcpy ( &Value, Data.data () + Position, sizeof ( T ) );
+                Position += sizeof ( T );
+                return true;
+                }
+
+            bool ReadBytes ( std::string & Out, size_t Size )
+                {
+                if (Position + Size > Data.size ()) return false;
+                Out.assign ( Data.data () + Position, Size );
+                Position += Size;
+                return true;
+                }
+
+            bool ReadString ( std::string & Out )
+                {
+                uint32_t size = 0;
+                return Read ( size ) && ReadBytes ( Out, size );
+                }
+
+            bool AtEnd () const { return Position >= Data.size (); }
+            size_t GetPosition () const { return Position; }
+            void Seek ( size_t InPosition ) { Position = InPosition; }
+
+        private:
+            const std::string & Data;
+            size_t Position = 0;
+        };
+
+    const char * GetLevelName ( uint8_t Level )
+        {
+        static const char * names[] = { "TRACE", "DEBUG", "INFO", "WARN", "ERROR", "CRITICAL" };
+        return Level < 6 ? names[ Level ] : "UNKNOWN";
+        }
+
+        // Same layout as Logger::GetCurrentTime: "YYYY-mm-dd HH:MM:SS.mmm", local time
+    std::string FormatTimestamp ( int64_t TimestampNs )
+        {
+        std::time_t seconds = static_cast< std::time_t >( TimestampNs / 1000000000 );
+        int64_t milliseconds = ( TimestampNs / 1000000 ) % 1000;
+
+        std::tm tm {};
+#ifdef _WIN32
+        localtime_s ( &tm, &seconds );
+#else
+        localtime_r ( &seconds, &tm );
+#endif
+        char buffer[ 32 ];
+        std::strftime ( buffer, sizeof ( buffer ), "%Y-%m-%d %H:%M:%S", &tm );
+
+        std::ostringstream ss;
+        ss << buffer << '.' << ( milliseconds < 100 ? ( milliseconds < 10 ? "00" : "0" ) : "" ) << milliseconds;
+        return ss.str ();
+        }
+
+    std::string FormatValue ( const ArgValue & Value, std::string_view Spec )
+        {
+        return std::visit ( [ Spec ] ( const auto & Alternative ) -> std::string
+                            {
+                            auto value = Alternative;
+                            std::string format = "{";
+                            if (!Spec.empty ())
+                                {
+                                format += ':';
+                                format += Spec;
+                                }
+                            format += '}';
+                            try
+                                {
+                                return std::vformat ( format, std::make_format_args ( value ) );
+                                }
+                                catch (const std::format_error &)
+                                    {
+                                    // Spec does not fit the stored type (e.g. a pre-formatted custom type)
+                                    return std::vformat ( "{}", std::make_format_args ( value ) );
+                                    }
+                            }, Value );
+        }
+
+        // Minimal std::format replacement field parser: "{}", "{N}", "{:spec}", "{N:spec}", "{{", "}}"
+    std::string FormatMessage ( const std::string & Format, const std::vector<ArgValue> & Args )
+        {
+        std::string result;
+        result.reserve ( Format.size () + Args.size () * 8 );
+
+        size_t nextArg = 0;
+        for (size_t i = 0; i < Format.size (); ++i)
+            {
+            char c = Format[ i ];
+            if (c == '{' && i + 1 < Format.size () && Format[ i + 1 ] == '{')
+                {
+                result += '{';
+                ++i;
+                continue;
+                }
+            if (c == '}' && i + 1 < Format.size () && Format[ i + 1 ] == '}')
+                {
+                result += '}';
+                ++i;
+                continue;
+                }
+            if (c != '{')
+                {
+                result += c;
+                continue;
+                }
+
+            size_t close = Format.find ( '}', i );
+            if (close == std::string::npos)
+                {
+                result.append ( Format, i, std::string::npos );
+                break;
+                }
+
+            std::string_view field ( Format.data () + i + 1, close - i - 1 );
+            size_t colon = field.find ( ':' );
+            std::string_view indexPart = field.substr ( 0, colon );
+            std::string_view spec = colon == std::string_view::npos ? std::string_view () : field.substr ( colon + 1 );
+
+            size_t argIndex = nextArg++;
+            if (!indexPart.empty ())
+                {
+                argIndex = 0;
+                for (char digit : indexPart)
+                    {
+                    argIndex = argIndex * 10 + static_cast< size_t >( digit - '0' );
+                    }
+                }
+
+            result += argIndex < Args.size () ? FormatValue ( Args[ argIndex ], spec ) : "<missing>";
+            i = close;
+            }
+        return result;
+        }
+
+    bool ReadArg ( RecordReader & Reader, ArgValue & OutValue )
+        {
+        ArgType type;
+        if (!Reader.Read ( type )) return false;
+
+        switch (type)
+            {
+                case ArgType::Int64:   { int64_t v; if (!Reader.Read ( v )) return false; OutValue = v; return true; }
+                case ArgType::UInt64:  { uint64_t v; if (!Reader.Read ( v )) return false; OutValue = v; return true; }
+                case ArgType::Double:  { double v; if (!Reader.Read ( v )) return false; OutValue = v; return true; }
+                case ArgType::Bool:    { uint8_t v; if (!Reader.Read ( v )) return false; OutValue = v != 0; return true; }
+                case ArgType::Char:    { char v; if (!Reader.Read ( v )) return false; OutValue = v; return true; }
+                case ArgType::String:  { std::string v; if (!Reader.ReadString ( v )) return false; OutValue = std::move ( v ); return true; }
+                case ArgType::Pointer:
+                    {
+                    uint64_t v;
+                    if (!Reader.Read ( v )) return false;
+                    OutValue = reinterpret_cast< const void * >( static_cast< uintptr_t >( v ) );
+                    return true;
+                    }
+            }
+        return false;
+        }
+    }
+
+int main ( int argc, char * argv [] )
+    {
+    if (argc < 2)
+        {
+        std::cout << "Usage: LogDecoderTool.exe <input.celog> [output.log]" << std::endl;
+        return 1;
+        }
+
+    std::ifstream input ( argv[ 1 ], std::ios::binary );
+    if (!input.is_open ())
+        {
+        std::cerr << "ERROR: Cannot open " << argv[ 1 ] << std::endl;
+        return 1;
+        }
+
+    std::string data ( ( std::istreambuf_iterator<char> ( input ) ), std::istreambuf_iterator<char> () );
+    if (data.size () < sizeof ( FILE_MAGIC ) || std::memcmp ( data.data (), FILE_MAGIC, sizeof ( FILE_MAGIC ) ) != 0)
+        {
+        std::cerr << "ERROR: " << argv[ 1 ] << " is not a ChudEngine binary log" << std::endl;
+        return 1;
+        }
+
+    std::ofstream outputFile;
+    if (argc >= 3)
+        {
+        outputFile.open ( argv[ 2 ] );
+        if (!outputFile.is_open ())
+            {
+            std::cerr << "ERROR: Cannot create " << argv[ 2 ] << std::endl;
+            return 1;
+            }
+        }
+    std::ostream & output = outputFile.is_open () ? static_cast< std::ostream & >( outputFile ) : std::cout;
+
+    std::unordered_map<uint32_t, FormatEntry> formats;
+    std::vector<ArgValue> args;
+    size_t messageCount = 0;
+
+    RecordReader reader ( data );
+    reader.Seek ( sizeof ( FILE_MAGIC ) );
+
+    while (!reader.AtEnd ())
+        {
+        size_t recordStart = reader.GetPosition ();
+        RecordType type;
+        reader.Read ( type );
+
+        bool bComplete = false;
+        if (type == RecordType::Format)
+            {
+            uint32_t id;
+            uint16_t categorySize;
+            FormatEntry entry;
+            bComplete = reader.Read ( id ) && reader.Read ( entry.Level ) && reader.Read ( categorySize )
+                && reader.ReadBytes ( entry.Category, categorySize ) && reader.ReadString ( entry.Format );
+            if (bComplete)
+                {
+                formats[ id ] = std::move ( entry );
+                }
+            }
+        else if (type == RecordType::Message)
+            {
+            uint32_t formatId;
+            int64_t timestamp;
+            uint8_t argCount;
+            bComplete = reader.Read ( formatId ) && reader.Read ( timestamp ) && reader.Read ( argCount );
+
+            args.clear ();
+            for (uint8_t i = 0; bComplete && i < argCount; ++i)
+                {
+                ArgValue value;
+                bComplete = ReadArg ( reader, value );
+                args.push_back ( std::move ( value ) );
+                }
+
+            if (bComplete)
+                {
+                auto it = formats.find ( formatId );
+                output << "[" << FormatTimestamp ( timestamp ) << "] ";
+                if (it != formats.end ())
+                    {
+                    output << "[" << GetLevelName ( it->second.Level ) << "] " << it->second.Category
+                        << FormatMessage ( it->second.Format, args ) << '\n';
+                    }
+                else
+                    {
+                    output << "[UNKNOWN] <format " << formatId << " not found>\n";
+                    }
+                ++messageCount;
+                }
+            }
+        else
+            {
+            std::cerr << "ERROR: Unknown record type " << static_cast< int >( type ) << " at offset " << recordStart << std::endl;
+            return 1;
+            }
+
+        if (!bComplete)
+            {
+                // The engine was probably stopped mid-write; everything before is still valid
+            std::cerr << "WARNING: Truncated record at offset " << recordStart << ", stopping" << std::endl;
+            break;
+            }
+        }
+
+    std::cerr << "Decoded " << messageCount << " messages, " << formats.size () << " formats" << std::endl;
+    return 0;
+    }
@@ -0,0 +1,355 @@
+// Micro-benchmarks of engine runtime pieces, built against the runtime sources outside the app
+#include "Core/CEObject/CEClass.hpp"
+#include "Core/CEObject/CEConcurrentEventQueue.hpp"
+#include "Core/CEObject/CEWorld.hpp"
+#include "Core/Memory/CEFrameAllocator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+    {
+    // Every global heap allocation of the tool, read by the frame-alloc mode
+    std::atomic<uint64_t> HeapAllocations { 0 };
+    }
+
+void * operator new( size_t Size )
+    {
+    HeapAllocations.fetch_add ( 1, std::memory_order_relaxed );
+    if (void * block = std::malloc ( Size ? Size : 1 ))
+        {
+        return block;
+        }
+    throw std::bad_alloc ();
+    }
+
+void * operator new( size_t Size, std::align_val_t Alignment )
+    {
+    HeapAllocations.fetch_add ( 1, std::memory_order_relaxed );
+    size_t alignment = static_cast< size_t >( Alignment );
+#if defined(_MSC_VER)
+    void * block = _aligned_malloc ( Size ? Size : 1, alignment );
+#else
+    void * block = std::aligned_alloc ( alignment, ( ( Size ? Size : 1 ) + alignment - 1 ) & ~( alignment - 1 ) );
+#endif
+    if (!block)
+        {
+        throw std::bad_alloc ();
+        }
+    return block;
+    }
+
+void operator delete( void * Block ) noexcept { std::free ( Block ); }
+void operator delete( void * Block, size_t ) noexcept { std::free ( Block ); }
+
+void operator delete( void * Block, std::align_val_t ) noexcept
+    {
+#if defined(_MSC_VER)
+    _aligned_free ( Block );
+#else
+    std::free ( Block );
+#endif
+    }
+
+void operator delete( void * Block, size_t, std::align_val_t Alignment ) noexcept { operator delete( Block, Alignment ); }
+
+namespace
+    {
+    using namespace CE;
+
+    struct BenchmarkEvent
+        {
+        uint64_t Sequence;
+        uint32_t Thread;
+        float Payload[ 4 ];
+        };
+
+    // Pushes from NumThreads threads while the main thread drains
+    int RunEventQueueBenchmark ( int argc, char * argv [] )
+        {
+        uint32_t numThreads = argc > 0 ? static_cast< uint32_t >( std::strtoul ( argv[ 0 ], nullptr, 10 ) ) : 4;
+        uint32_t eventsPerThread = argc > 1 ? static_cast< uint32_t >( std::strtoul ( argv[ 1 ], nullptr, 10 ) ) : 1000000;
+
+        CEConcurrentEventQueue queue;
+        std::atomic<uint32_t> finishedThreads { 0 };
+        std::atomic<bool> bStart { false };
+
+        CEEventDrainFunction drain = [] ( CEEventSystem *, void * Payload )
+            {
+            static_cast< BenchmarkEvent * >( Payload )->~BenchmarkEvent ();
+            };
+
+        std::vector<std::thread> threads;
+        threads.reserve ( numThreads );
+        for (uint32_t t = 0; t < numThreads; ++t)
+            {
+            threads.emplace_back ( [ &, t ] ()
+                                   {
+                                   while (!bStart.load ( std::memory_order_acquire ))
+                                       {
+                                       std::this_thread::yield ();
+                                       }
+                                   for (uint32_t i = 0; i < eventsPerThread; ++i)
+                                       {
+                                       queue.Push<BenchmarkEvent> ( drain, BenchmarkEvent { i, t, { 1.0f, 2.0f, 3.0f, 4.0f } } );
+                                       }
+                                   finishedThreads.fetch_add ( 1, std::memory_order_release );
+                                   } );
+            }
+
+        uint64_t drained = 0;
+        auto startTime = std::chrono::steady_clock::now ();
+        bStart.store ( true, std::memory_order_release );
+
+        while (finishedThreads.load ( std::memory_order_acquire ) < numThreads)
+            {
+            drained += queue.Drain ( nullptr );
+            }
+        drained += queue.Drain ( nullptr );
+
+        auto endTime = std::chrono::steady_clock::now ();
+        for (std::thread & thread : threads)
+            {
+            thread.join ();
+            }
+
+        double seconds = std::chrono::duration<double> ( endTime - startTime ).count ();
+        std::cout << "ConcurrentEventQueue: " << numThreads << " threads, " << drained << " events in "
+            << seconds * 1000.0 << " ms, " << ( seconds > 0.0 ? drained / seconds / 1e6 : 0.0 ) << " M events/sec" << std::endl;
+
+        if (drained != static_cast< uint64_t >( numThreads ) * eventsPerThread)
+            {
+            std::cerr << "ERROR: pushed " << static_cast< uint64_t >( numThreads ) * eventsPerThread
+                << " events, drained " << drained << std::endl;
+            return 1;
+            }
+        return 0;
+        }
+
+    // Inheritance chain for the cast benchmark
+    class CastLevel0 : public CEObject { DECLARE_CLASS ( CastLevel0, CEObject ) };
+    class CastLevel1 : public CastLevel0 { DECLARE_CLASS ( CastLevel1, CastLevel0 ) };
+    class CastLevel2 : public CastLevel1 { DECLARE_CLASS ( CastLevel2, CastLevel1 ) };
+    class CastLevel3 : public CastLevel2 { DECLARE_CLASS ( CastLevel3, CastLevel2 ) };
+    class CastLevel4 : public CastLevel3 { DECLARE_CLASS ( CastLevel4, CastLevel3 ) };
+    class CastLevel5 : public CastLevel4 { DECLARE_CLASS ( CastLevel5, CastLevel4 ) };
+    class CastLevel6 : public CastLevel5 { DECLARE_CLASS ( CastLevel6, CastLevel5 ) };
+    class CastLevel7 : public CastLevel6 { DECLARE_CLASS ( CastLevel7, CastLevel6 ) };
+
+    CEObject * CreateCastObject ( uint32_t Level )
+        {
+        switch (Level % 8)
+            {
+                case 0: return new CastLevel0 ();
+                case 1: return new CastLevel1 ();
+                case 2: return new CastLevel2 ();
+                case 3: return new CastLevel3 ();
+                case 4: return new CastLevel4 ();
+                case 5: return new CastLevel5 ();
+                case 6: return new CastLevel6 ();
+                default: return new CastLevel7 ();
+            }
+        }
+
+    // Compares dynamic_cast with CEObject::CastTo on objects spread over an eight-class chain
+    int RunCastBenchmark ( int argc, char * argv [] )
+        {
+        uint32_t numObjects = argc > 0 ? static_cast< uint32_t >( std::strtoul ( argv[ 0 ], nullptr, 10 ) ) : 4096;
+        uint32_t iterations = argc > 1 ? static_cast< uint32_t >( std::strtoul ( argv[ 1 ], nullptr, 10 ) ) : 1000;
+
+        std::vector<CEObject *> objects;
+        objects.reserve ( numObjects );
+        for (uint32_t i = 0; i < numObjects; ++i)
+            {
+            objects.push_back ( CreateCastObject ( i ) );
+            }
+
+            // Reading through volatile keeps the compiler from hoisting the casts out of the iteration loop
+        CEObject * volatile * volatileObjects = objects.data ();
+
+            // The target sits mid-chain: half of the objects match, dynamic_cast walks several levels
+        uint64_t dynamicMatches = 0;
+        auto dynamicStart = std::chrono::steady_clock::now ();
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+            {
+            for (uint32_t i = 0; i < numObjects; ++i)
+                {
+                dynamicMatches += dynamic_cast< CastLevel4 * >( volatileObjects[ i ] ) != nullptr;
+                }
+            }
+        auto dynamicEnd = std::chrono::steady_clock::now ();
+
+        uint64_t classMatches = 0;
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+            {
+            for (uint32_t i = 0; i < numObjects; ++i)
+                {
+                classMatches += volatileObjects[ i ]->CastTo<CastLevel4> () != nullptr;
+                }
+            }
+        auto classEnd = std::chrono::steady_clock::now ();
+
+        for (CEObject * object : objects)
+            {
+            delete object;
+            }
+
+        double casts = std::max ( static_cast< double >( numObjects ) * iterations, 1.0 );
+        std::cout << "Cast: " << numObjects << " objects x " << iterations << " iterations, dynamic_cast "
+            << std::chrono::duration<double, std::nano> ( dynamicEnd - dynamicStart ).count () / casts << " ns ("
+            << dynamicMatches << " hits), CastTo "
+            << std::chrono::duration<double, std::nano> ( classEnd - dynamicEnd ).count () / casts << " ns ("
+            << classMatches << " hits) per cast" << std::endl;
+
+        if (dynamicMatches != classMatches)
+            {
+            std::cerr << "ERROR: CastTo disagrees with dynamic_cast" << std::endl;
+            return 1;
+            }
+        return 0;
+        }
+
+    class FrameTestComponent : public CEComponent
+        {
+        DECLARE_CLASS ( FrameTestComponent, CEComponent )
+        public:
+            float Time = 0.0f;
+            virtual void Tick ( float DeltaTime ) override { Time += DeltaTime; }
+        };
+
+    class FrameTestSubComponent : public FrameTestComponent
+        {
+        DECLARE_CLASS ( FrameTestSubComponent, FrameTestComponent )
+        };
+
+    class FrameTestActor : public CEActor
+        {
+        DECLARE_CLASS ( FrameTestActor, CEActor )
+        public:
+            FrameTestActor () : CEActor ( "FrameTestActor" )
+                {
+                CreateComponent<FrameTestComponent> ();
+                CreateComponent<FrameTestSubComponent> ();
+                }
+        };
+
+    struct FrameTestEvent : public CEEvent
+        {
+        DECLARE_EVENT ( FrameTestEvent )
+        explicit FrameTestEvent ( int InValue ) : Value ( InValue ) { }
+        int Value;
+        };
+
+    // Runs world frames (tick, component queries, queued events) and counts global heap allocations
+    // once the world is warm; the frame allocator and the engine's pools must cover all of them
+    int RunFrameAllocBenchmark ( int argc, char * argv [] )
+        {
+        uint32_t numActors = argc > 0 ? static_cast< uint32_t >( std::strtoul ( argv[ 0 ], nullptr, 10 ) ) : 2000;
+        uint32_t numFrames = argc > 1 ? static_cast< uint32_t >( std::strtoul ( argv[ 1 ], nullptr, 10 ) ) : 100;
+        constexpr uint32_t WARMUP_FRAMES = 5;
+        constexpr uint32_t EVENTS_PER_FRAME = 100;
+
+        CEFrameAllocator::Init ();
+
+        uint64_t steadyAllocations = 0;
+        uint64_t handledEvents = 0;
+        double seconds = 0.0;
+            {
+            CEWorld world ( "FrameAllocWorld" );
+            world.SetEntityStorageEnabled ( true );
+            world.SpawnActors<FrameTestActor> ( numActors );
+            world.GetEventSystem ()->RegisterHandler<FrameTestEvent> ( [ & ] ( const FrameTestEvent & Event )
+                                                                       {
+                                                                       handledEvents += Event.Value;
+                                                                       } );
+
+            auto runFrame = [ & ] ()
+                {
+                CEFrameAllocator::BeginFrame ();
+                world.Tick ( 1.0f / 60.0f );
+
+                auto components = world.GetComponentsOfType<FrameTestComponent> ();
+                auto subComponents = world.GetComponentsOfType<FrameTestSubComponent> ();
+                handledEvents += components.size () + subComponents.size ();
+
+                for (uint32_t i = 0; i < EVENTS_PER_FRAME; ++i)
+                    {
+                    world.GetEventSystem ()->QueueEvent<FrameTestEvent> ( 1 );
+                    }
+                };
+
+            for (uint32_t frame = 0; frame < WARMUP_FRAMES; ++frame)
+                {
+                runFrame ();
+                }
+
+            uint64_t allocationsBefore = HeapAllocations.load ( std::memory_order_relaxed );
+            auto startTime = std::chrono::steady_clock::now ();
+            for (uint32_t frame = 0; frame < numFrames; ++frame)
+                {
+                runFrame ();
+                }
+            seconds = std::chrono::duration<double> ( std::chrono::steady_clock::now () - startTime ).count ();
+            steadyAllocations = HeapAllocations.load ( std::memory_order_relaxed ) - allocationsBefore;
+            }
+
+        CEFrameAllocatorStats stats = CEFrameAllocator::GetStats ();
+        CEFrameAllocator::Shutdown ();
+
+        std::cout << "FrameAlloc: " << numActors << " actors x " << numFrames << " frames, "
+            << seconds * 1000.0 / std::max ( numFrames, 1u ) << " ms/frame, " << steadyAllocations
+            << " heap allocations, frame memory peak " << stats.PeakBytesUsed << " bytes, "
+            << stats.TotalHeapFallbacks << " fallbacks (" << handledEvents << " items handled)" << std::endl;
+
+        if (steadyAllocations != 0 || stats.TotalHeapFallbacks != 0)
+            {
+            std::cerr << "ERROR: steady-state frames allocated from the heap" << std::endl;
+            return 1;
+            }
+        return 0;
+        }
+
+    struct BenchmarkEntry
+        {
+        const char * Name;
+        const char * Arguments;
+        int ( *Run )( int argc, char * argv [] );
+        };
+
+    const BenchmarkEntry Benchmarks[] =
+        {
+        { "event-queue", "[threads=4] [events-per-thread=1000000]", &RunEventQueueBenchmark },
+        { "cast", "[objects=4096] [iterations=1000]", &RunCastBenchmark },
+        { "frame-alloc", "[actors=2000] [frames=100]", &RunFrameAllocBenchmark },
+        };
+    }
+
+int main ( int argc, char * argv [] )
+    {
+    CE::Logger::SetLogLevel ( CE::LogLevel::Warn ); // objects log their creation at Debug
+
+    if (argc >= 2)
+        {
+        for (const BenchmarkEntry & benchmark : Benchmarks)
+            {
+            if (std::strcmp ( argv[ 1 ], benchmark.Name ) == 0)
+                {
+                return benchmark.Run ( argc - 2, argv + 2 );
+                }
+            }
+        }
+
+    std::cout << "Usage: RuntimeBenchmarkTool.exe <benchmark> [arguments]" << std::endl;
+    for (const BenchmarkEntry & benchmark : Benchmarks)
+        {
+        std::cout << "  " << benchmark.Name << " " << benchmark.Arguments << std::endl;
+        }
+    return 1;
+    }